@@ -54,10 +54,9 @@ int EventFD::getFD() const
     return mFD;
 }
 
-void EventFD::send()
+void EventFD::send(const std::uint64_t count)
 {
-    const std::uint64_t toSend = 1;
-    utils::write(mFD, &toSend, sizeof(toSend));
+    utils::write(mFD, &count, sizeof(count));
 }
 
 void EventFD::receive()
@@ -25,6 +25,8 @@
 #ifndef COMMON_UTILS_EVENTFD_HPP
 #define COMMON_UTILS_EVENTFD_HPP
 
+#include <cstdint>
+
 namespace utils {
 
 class EventFD {
@@ -43,8 +45,10 @@ public:
 
     /**
      * Send an event of a given value
+     *
+     * @param count number of events sent in one write
      */
-    void send();
+    void send(const std::uint64_t count = 1);
 
     /**
      * Receives the signal.
@@ -125,6 +125,11 @@ struct EventFDException: public UtilsException {
     explicit EventFDException(const std::string& msg, int err = 0) : UtilsException(msg, err) {}
 };
 
+struct TimerFDException: public UtilsException {
+
+    explicit TimerFDException(const std::string& msg, int err = 0) : UtilsException(msg, err) {}
+};
+
 
 void fillInStackTrace(std::vector<std::string>& bt);
 
@@ -37,6 +37,7 @@
 #include <fstream>
 #include <streambuf>
 #include <cstring>
+#include <cstdlib>
 #include <cerrno>
 #include <sys/stat.h>
 #include <sys/mount.h>
@@ -45,6 +46,7 @@
 #include <fcntl.h>
 #include <sys/syscall.h>
 
+#include <atomic>
 #include <iostream>
 
 namespace fs = boost::filesystem;
@@ -292,6 +294,56 @@ void saveFileContent(const std::string& path, const std::string& content)
     }
 }
 
+void saveFileContentAtomic(const std::string& path, const std::string& content)
+{
+    // A symlink is kept, the file it points to is replaced
+    std::string target = path;
+    char* resolved = ::realpath(path.c_str(), nullptr);
+    if (resolved != nullptr) {
+        target = resolved;
+        ::free(resolved);
+    }
+
+    struct stat targetStat;
+    const bool exists = ::stat(target.c_str(), &targetStat) == 0;
+
+    static std::atomic<unsigned int> tmpCounter(0);
+    const std::string tmpPath = target + ".tmp" + std::to_string(::getpid()) + "." + std::to_string(tmpCounter++);
+    int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        THROW_EXCEPTION(UtilsException, path << ": could not open for writing", errno);
+    }
+
+    const char* data = content.data();
+    size_t left = content.size();
+    int err = 0;
+    while (left > 0) {
+        const ssize_t written = ::write(fd, data, left);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            err = errno;
+            break;
+        }
+        data += written;
+        left -= static_cast<size_t>(written);
+    }
+    if (err == 0 && exists && ::fchmod(fd, targetStat.st_mode & 07777) == -1) {
+        err = errno;
+    }
+    if (::close(fd) == -1 && err == 0) {
+        err = errno;
+    }
+    if (err == 0 && ::rename(tmpPath.c_str(), target.c_str()) == -1) {
+        err = errno;
+    }
+    if (err != 0) {
+        ::unlink(tmpPath.c_str());
+        THROW_EXCEPTION(UtilsException, path << ": could not write to", err);
+    }
+}
+
 void readFirstLineOfFile(const std::string& path, std::string& ret)
 {
     std::ifstream file(path);
@@ -84,6 +84,14 @@ std::string readFileContent(const std::string& path);
  */
 void saveFileContent(const std::string& path, const std::string& content);
 
+/**
+ * Save the content to a new file and rename() it over the regular file at the path,
+ * so the readers never see a partially written or truncated file.
+ * The directory has to be writable. The new file gets the mode of the old one,
+ * but not its owner, extended attributes or labels. Throws exception on error
+ */
+void saveFileContentAtomic(const std::string& path, const std::string& content);
+
 /**
  * Read a line from file
  * Its goal is to read a kernel config files (eg. from /proc, /sys/).
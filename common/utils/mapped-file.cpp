@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Read only memory mapping of a file
+ */
+
+#include "config.hpp"
+
+#include "utils/mapped-file.hpp"
+#include "utils/exception.hpp"
+#include "utils/fd-utils.hpp"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace utils {
+
+MappedFile::MappedFile(const std::string& path)
+    : mAddress(nullptr),
+      mSize(0)
+{
+    int fd = utils::open(path, O_RDONLY | O_CLOEXEC);
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) == -1) {
+        const int err = errno;
+        utils::close(fd);
+        THROW_EXCEPTION(UtilsException, path << ": fstat failed", err);
+    }
+    if (!S_ISREG(fileStat.st_mode) || fileStat.st_size == 0) {
+        // Size of pipes and /proc entries is unknown (or 0), read them until the end
+        char buffer[4096];
+        for (;;) {
+            const ssize_t size = ::read(fd, buffer, sizeof(buffer));
+            if (size < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                const int err = errno;
+                utils::close(fd);
+                THROW_EXCEPTION(UtilsException, path << ": read failed", err);
+            }
+            if (size == 0) {
+                break;
+            }
+            mBuffer.append(buffer, static_cast<std::size_t>(size));
+        }
+        mSize = mBuffer.size();
+        utils::close(fd);
+        return;
+    }
+
+    mSize = static_cast<std::size_t>(fileStat.st_size);
+    mAddress = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mAddress == MAP_FAILED) {
+        const int err = errno;
+        mAddress = nullptr;
+        utils::close(fd);
+        THROW_EXCEPTION(UtilsException, path << ": mmap failed", err);
+    }
+    // Parsers read the file once from the beginning
+    ::madvise(mAddress, mSize, MADV_SEQUENTIAL);
+
+    // The mapping stays valid without the descriptor
+    utils::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (mAddress) {
+        ::munmap(mAddress, mSize);
+    }
+}
+
+const char* MappedFile::data() const
+{
+    return mAddress ? static_cast<const char*>(mAddress) : mBuffer.data();
+}
+
+std::size_t MappedFile::size() const
+{
+    return mSize;
+}
+
+} // namespace utils
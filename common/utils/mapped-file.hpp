@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Read only memory mapping of a file
+ */
+
+#ifndef COMMON_UTILS_MAPPED_FILE_HPP
+#define COMMON_UTILS_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace utils {
+
+/**
+ * Maps the whole file into memory for reading, the content is read from the page cache without copying.
+ * Files that can't be mapped, like pipes or /proc entries, are read into a buffer.
+ * The content is not null terminated. Nobody may truncate the file while it's mapped,
+ * otherwise reading the mapping raises SIGBUS. Write such files with saveFileContentAtomic().
+ */
+class MappedFile {
+public:
+    /**
+     * @param path  path to the file
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @return beginning of the content, not null for empty files too
+     */
+    const char* data() const;
+    std::size_t size() const;
+
+private:
+    void* mAddress;
+    std::size_t mSize;
+    std::string mBuffer;
+};
+
+} // namespace utils
+
+#endif // COMMON_UTILS_MAPPED_FILE_HPP
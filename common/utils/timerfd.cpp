@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Timerfd wrapper
+ */
+
+#include "config.hpp"
+
+#include "utils/timerfd.hpp"
+#include "utils/exception.hpp"
+#include "utils/fd-utils.hpp"
+
+#include <sys/timerfd.h>
+#include <algorithm>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+namespace utils {
+
+namespace {
+
+void setTime(int fd, const std::chrono::microseconds& timeout)
+{
+    struct itimerspec spec;
+    ::memset(&spec, 0, sizeof(spec));
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    spec.it_value.tv_sec = seconds.count();
+    spec.it_value.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds).count();
+
+    if (-1 == ::timerfd_settime(fd, 0, &spec, nullptr)) {
+        THROW_EXCEPTION(TimerFDException, "Error in timerfd_settime", errno);
+    }
+}
+
+} // namespace
+
+TimerFD::TimerFD()
+{
+    mFD = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (mFD == -1) {
+        THROW_EXCEPTION(TimerFDException, "Error in timerfd_create", errno);
+    }
+}
+
+TimerFD::~TimerFD()
+{
+    utils::close(mFD);
+}
+
+int TimerFD::getFD() const
+{
+    return mFD;
+}
+
+void TimerFD::arm(const std::chrono::microseconds& timeout)
+{
+    // Zero would disarm the timer
+    setTime(mFD, std::max(timeout, std::chrono::microseconds(1)));
+}
+
+void TimerFD::disarm()
+{
+    setTime(mFD, std::chrono::microseconds(0));
+}
+
+void TimerFD::receive()
+{
+    std::uint64_t expirations;
+    if (-1 == ::read(mFD, &expirations, sizeof(expirations)) && errno != EAGAIN) {
+        THROW_EXCEPTION(TimerFDException, "Error in timerfd read", errno);
+    }
+}
+
+} // namespace utils
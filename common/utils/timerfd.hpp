@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Timerfd wrapper
+ */
+
+#ifndef COMMON_UTILS_TIMERFD_HPP
+#define COMMON_UTILS_TIMERFD_HPP
+
+#include <chrono>
+
+namespace utils {
+
+/**
+ * One-shot, non-blocking monotonic timer usable with poll/epoll
+ */
+class TimerFD {
+public:
+
+    TimerFD();
+    virtual ~TimerFD();
+
+    TimerFD(const TimerFD& timerfd) = delete;
+    TimerFD& operator=(const TimerFD&) = delete;
+
+    /**
+    * @return timer's file descriptor.
+    */
+    int getFD() const;
+
+    /**
+     * Starts the timer, overrides the previous setting
+     *
+     * @param timeout time after which the file descriptor becomes readable
+     */
+    void arm(const std::chrono::microseconds& timeout);
+
+    /**
+     * Stops the timer
+     */
+    void disarm();
+
+    /**
+     * Consumes the expiration.
+     * Doesn't block if the timer hasn't expired.
+     */
+    void receive();
+
+private:
+    int mFD;
+};
+
+} // namespace utils
+
+#endif // COMMON_UTILS_TIMERFD_HPP
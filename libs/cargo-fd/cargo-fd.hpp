@@ -30,14 +30,128 @@
 #include "cargo-fd/internals/to-fdstore-internet-visitor.hpp"
 #include "cargo-fd/internals/from-fdstore-visitor.hpp"
 #include "cargo-fd/internals/from-fdstore-internet-visitor.hpp"
+#include "cargo-fd/internals/to-fdstore-tagged-visitor.hpp"
+#include "cargo-fd/internals/from-fdstore-tagged-visitor.hpp"
+#include "cargo-fd/internals/to-fdstore-compact-visitor.hpp"
+#include "cargo-fd/internals/from-fdstore-compact-visitor.hpp"
+#include "cargo-fd/internals/fd-codec.hpp"
 
 
 namespace cargo {
 
+namespace internals {
+
+namespace tagged {
+
+template <class Cargo>
+void load(const int fd, Cargo& visitable)
+{
+    ReceivedMessage message(fd);
+    FromFDStoreTaggedVisitor visitor(message.getInput(), message);
+    accept(visitable, visitor);
+}
+
+template <class Cargo>
+void save(const int fd, const Cargo& visitable)
+{
+    MessageBuilder output;
+    std::vector<int> fds;
+    ToFDStoreTaggedVisitor visitor(output, fds);
+    accept(visitable, visitor);
+    output.send(fd, fds);
+}
+
+} // namespace tagged
+
+namespace compact {
+
+template <class Cargo>
+void load(const int fd, Cargo& visitable)
+{
+    ReceivedMessage message(fd);
+    MessageInput input = message.getInput();
+    FromFDStoreCompactVisitor visitor(input, message);
+    visitable.accept(visitor);
+}
+
+template <class Cargo>
+void save(const int fd, const Cargo& visitable)
+{
+    MessageBuilder output;
+    std::vector<int> fds;
+    ToFDStoreCompactVisitor visitor(output, fds);
+    visitable.accept(visitor);
+    output.send(fd, fds);
+}
+
+} // namespace compact
+
+template <class Cargo, class HasFDCodec>
+void loadFromFD(const int fd, Cargo& visitable, std::true_type /*isFDTagged*/, HasFDCodec)
+{
+    tagged::load(fd, visitable);
+}
+
+template <class Cargo>
+void loadFromFD(const int fd, Cargo& visitable, std::false_type /*isFDTagged*/, std::true_type /*hasFDCodec*/)
+{
+    fdcodec::load(fd, visitable);
+}
+
+template <class Cargo>
+void loadFromFD(const int fd, Cargo& visitable, std::false_type /*isFDTagged*/, std::false_type /*hasFDCodec*/)
+{
+    FDReceiveBatch fdBatch(fd);
+    FromFDStoreVisitor visitor(fd, fdBatch);
+    visitable.accept(visitor);
+}
+
+template <class Cargo, class HasFDCodec>
+void saveToFD(const int fd, const Cargo& visitable, std::true_type /*isFDTagged*/, HasFDCodec)
+{
+    tagged::save(fd, visitable);
+}
+
+template <class Cargo>
+void saveToFD(const int fd, const Cargo& visitable, std::false_type /*isFDTagged*/, std::true_type /*hasFDCodec*/)
+{
+    fdcodec::save(fd, visitable);
+}
+
+template <class Cargo>
+void saveToFD(const int fd, const Cargo& visitable, std::false_type /*isFDTagged*/, std::false_type /*hasFDCodec*/)
+{
+    FDSendBatch fdBatch(fd);
+    ToFDStoreVisitor visitor(fd, fdBatch);
+    visitable.accept(visitor);
+    fdBatch.send();
+}
+
+} // namespace internals
+
 /*@{*/
 
+/**
+ * Binary encodings selectable in saveToFD and loadFromFD
+ */
+enum class FDEncoding {
+    DEFAULT,    ///< Integers and sizes at full width, or the format chosen by the structure
+    COMPACT     ///< Integers and sizes as varints, the message is written and read at once
+};
+
+/**
+ * Compression of the messages written at once: FDEncoding::COMPACT and the tagged format.
+ * Readers decompress the messages without being told.
+ */
+enum class FDCompression {
+    NONE,
+    LZ4         ///< Messages of at least 512 bytes are compressed if they get smaller
+};
+
 /**
  * Load binary data from a file/socket/pipe represented by the fd
+ * Structures generated by cargo-fd-codegen are decoded with the generated code
+ * Structures with CARGO_FD_TAGGED are read in the tagged format
  *
  * @param fd        file descriptor
  * @param visitable visitable structure to load
@@ -47,12 +161,14 @@ void loadFromFD(const int fd, Cargo& visitable)
 {
     static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
 
-    internals::FromFDStoreVisitor visitor(fd);
-    visitable.accept(visitor);
+    internals::loadFromFD(fd, visitable, internals::isFDTagged<Cargo>(), internals::hasFDCodec<Cargo>());
 }
 
 /**
  * Save binary data to a file/socket/pipe represented by the fd
+ * FileDescriptor fields need a UNIX socket, all of them are passed with one sendmsg
+ * Structures generated by cargo-fd-codegen are encoded with the generated code
+ * Structures with CARGO_FD_TAGGED are written in the tagged format
  *
  * @param fd        file descriptor
  * @param visitable visitable structure to save
@@ -62,8 +178,87 @@ void saveToFD(const int fd, const Cargo& visitable)
 {
     static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
 
-    internals::ToFDStoreVisitor visitor(fd);
-    visitable.accept(visitor);
+    internals::saveToFD(fd, visitable, internals::isFDTagged<Cargo>(), internals::hasFDCodec<Cargo>());
+}
+
+/**
+ * Load binary data from a file/socket/pipe represented by the fd
+ *
+ * @param fd        file descriptor
+ * @param visitable visitable structure to load
+ * @param encoding  encoding used by the writer
+ */
+template <class Cargo>
+void loadFromFD(const int fd, Cargo& visitable, const FDEncoding encoding)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    if (encoding == FDEncoding::COMPACT) {
+        internals::compact::load(fd, visitable);
+    } else {
+        loadFromFD(fd, visitable);
+    }
+}
+
+/**
+ * Save binary data to a file/socket/pipe represented by the fd
+ * FDEncoding::COMPACT makes messages dominated by small integers and short strings smaller
+ *
+ * @param fd          file descriptor
+ * @param visitable   visitable structure to save
+ * @param encoding    encoding of the integers and sizes
+ * @param compression compression of the messages written at once
+ */
+template <class Cargo>
+void saveToFD(const int fd,
+              const Cargo& visitable,
+              const FDEncoding encoding,
+              const FDCompression compression = FDCompression::NONE)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    internals::CompressionScope compressionScope(compression == FDCompression::LZ4 ||
+                                                 internals::CompressionScope::isEnabled());
+    if (encoding == FDEncoding::COMPACT) {
+        internals::compact::save(fd, visitable);
+    } else {
+        saveToFD(fd, visitable);
+    }
+}
+
+/**
+ * Load binary data in the tagged format (see CARGO_FD_TAGGED) from a file/socket/pipe
+ * Fields unknown to this version of the structure are skipped
+ *
+ * @param fd        file descriptor
+ * @param visitable visitable structure to load
+ */
+template <class Cargo>
+void loadFromFDTagged(const int fd, Cargo& visitable)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    internals::tagged::load(fd, visitable);
+}
+
+/**
+ * Save binary data in the tagged format (see CARGO_FD_TAGGED) to a file/socket/pipe
+ * The message is written with one write, FileDescriptor fields need a UNIX socket
+ *
+ * @param fd          file descriptor
+ * @param visitable   visitable structure to save
+ * @param compression compression of the message
+ */
+template <class Cargo>
+void saveToFDTagged(const int fd,
+                    const Cargo& visitable,
+                    const FDCompression compression = FDCompression::NONE)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    internals::CompressionScope compressionScope(compression == FDCompression::LZ4 ||
+                                                 internals::CompressionScope::isEnabled());
+    internals::tagged::save(fd, visitable);
 }
 
 /**
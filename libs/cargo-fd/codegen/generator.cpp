@@ -0,0 +1,599 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Writes the C++ header for the structures read from the IDL
+ */
+
+#include "config.hpp"
+
+#include "generator.hpp"
+
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace cargo {
+
+namespace codegen {
+
+namespace {
+
+const std::string FDCODEC = "::cargo::internals::fdcodec::";
+const std::string SIZE_T = "std::size_t";
+
+/**
+ * Lines of code with their indentation levels
+ */
+class Code {
+public:
+    Code()
+        : mDepth(0)
+    {
+    }
+
+    void line(const std::string& text)
+    {
+        mLines.emplace_back(mDepth, text);
+    }
+
+    void open(const std::string& text)
+    {
+        line(text);
+        ++mDepth;
+    }
+
+    void close(const std::string& text = "}")
+    {
+        --mDepth;
+        line(text);
+    }
+
+    void append(const Code& code)
+    {
+        for (const auto& codeLine : code.mLines) {
+            mLines.emplace_back(mDepth + codeLine.first, codeLine.second);
+        }
+    }
+
+    void write(std::ostream& out) const
+    {
+        for (const auto& codeLine : mLines) {
+            if (!codeLine.second.empty()) {
+                out << std::string(codeLine.first * 4, ' ') << codeLine.second;
+            }
+            out << '\n';
+        }
+    }
+
+private:
+    std::vector<std::pair<unsigned int, std::string>> mLines;
+    unsigned int mDepth;
+};
+
+/**
+ * Adds a fixed size to a sum, skips empty structures
+ */
+void addSize(std::vector<std::string>& sizes, const std::string& size)
+{
+    if (size != "0") {
+        sizes.push_back(size);
+    }
+}
+
+std::string join(const std::vector<std::string>& parts, const std::string& separator)
+{
+    std::string result;
+    for (const std::string& part : parts) {
+        if (!result.empty()) {
+            result += separator;
+        }
+        result += part;
+    }
+    return result;
+}
+
+/**
+ * Writes the body of one generated function
+ */
+class FunctionWriter {
+public:
+    FunctionWriter(const Schema& schema, Code& code)
+        : mSchema(schema),
+          mCode(code),
+          mCounter(0)
+    {
+    }
+
+    std::string getFixedSize(const Type& type) const
+    {
+        switch (type.kind) {
+        case Type::Kind::SCALAR:
+            return "sizeof(" + type.name + ")";
+        case Type::Kind::ENUM:
+            return "sizeof(" + type.element->name + ")";
+        case Type::Kind::ARRAY: {
+            const std::string elementSize = getFixedSize(*type.element);
+            if (type.arraySize == 0 || elementSize == "0") {
+                return "0";
+            }
+            return std::to_string(type.arraySize) + " * (" + elementSize + ")";
+        }
+        case Type::Kind::STRUCT: {
+            std::vector<std::string> sizes;
+            for (const Field& field : getStruct(type.name).fields) {
+                addSize(sizes, getFixedSize(field.type));
+            }
+            return sizes.empty() ? "0" : join(sizes, " + ");
+        }
+        default:
+            return "0";
+        }
+    }
+
+    void writeSize(const Type& type, const std::string& value)
+    {
+        if (type.isFixedSize()) {
+            mCode.line("size += " + getFixedSize(type) + ";");
+            return;
+        }
+
+        switch (type.kind) {
+        case Type::Kind::STRING:
+            mCode.line("size += sizeof(" + SIZE_T + ") + " + value + ".size();");
+            break;
+        case Type::Kind::STRUCT:
+            mCode.line("size += " + value + ".getFDSize();");
+            break;
+        case Type::Kind::VECTOR:
+            if (type.element->isFixedSize()) {
+                mCode.line("size += sizeof(" + SIZE_T + ") + " + value + ".size() * (" +
+                           getFixedSize(*type.element) + ");");
+            } else {
+                mCode.line("size += sizeof(" + SIZE_T + ");");
+                writeSizeLoop(*type.element, value);
+            }
+            break;
+        case Type::Kind::ARRAY:
+            writeSizeLoop(*type.element, value);
+            break;
+        case Type::Kind::MAP: {
+            const std::string item = newName("v");
+            mCode.line("size += sizeof(" + SIZE_T + ");");
+            mCode.open("for (const auto& " + item + " : " + value + ") {");
+            mCode.line("size += sizeof(" + SIZE_T + ") + " + item + ".first.size();");
+            writeSize(*type.element, item + ".second");
+            mCode.close();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    void writeEncode(const Type& type, const std::string& value)
+    {
+        switch (type.kind) {
+        case Type::Kind::SCALAR:
+        case Type::Kind::STRING:
+            mCode.line("out = " + FDCODEC + "put(out, " + value + ");");
+            break;
+        case Type::Kind::ENUM:
+            mCode.line("out = " + FDCODEC + "put(out, static_cast<" + type.element->name + ">(" + value + "));");
+            break;
+        case Type::Kind::STRUCT:
+            mCode.line("out = " + value + ".encodeFD(out);");
+            break;
+        case Type::Kind::VECTOR:
+            mCode.line("out = " + FDCODEC + "put(out, " + value + ".size());");
+            writeEncodeElements(*type.element, value);
+            break;
+        case Type::Kind::ARRAY:
+            writeEncodeElements(*type.element, value);
+            break;
+        case Type::Kind::MAP: {
+            const std::string item = newName("v");
+            mCode.line("out = " + FDCODEC + "put(out, " + value + ".size());");
+            mCode.open("for (const auto& " + item + " : " + value + ") {");
+            mCode.line("out = " + FDCODEC + "put(out, " + item + ".first);");
+            writeEncode(*type.element, item + ".second");
+            mCode.close();
+            break;
+        }
+        }
+    }
+
+    /**
+     * Decodes a fixed size value from the memory pointed by 'in'
+     */
+    void writeUnpack(Code& code, const Type& type, const std::string& value)
+    {
+        switch (type.kind) {
+        case Type::Kind::SCALAR:
+            code.line("in = " + FDCODEC + "get(in, " + value + ");");
+            break;
+        case Type::Kind::ENUM: {
+            const std::string underlying = newName("value");
+            code.line(type.element->name + " " + underlying + ";");
+            code.line("in = " + FDCODEC + "get(in, " + underlying + ");");
+            code.line(value + " = static_cast<" + type.name + ">(" + underlying + ");");
+            break;
+        }
+        case Type::Kind::STRUCT:
+            code.line("in = " + value + ".decodeFD(in);");
+            break;
+        case Type::Kind::ARRAY:
+            if (type.element->kind == Type::Kind::SCALAR) {
+                code.line("in = " + FDCODEC + "get(in, " + value + ".data(), " + value + ".size());");
+            } else {
+                const std::string item = newName("v");
+                code.open("for (auto& " + item + " : " + value + ") {");
+                writeUnpack(code, *type.element, item);
+                code.close();
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * Decodes a value from the store. Consecutive fixed size values are read with one call.
+     */
+    void writeDecode(const Type& type, const std::string& value)
+    {
+        if (type.isFixedSize()) {
+            const std::string size = getFixedSize(type);
+            if (size != "0") {
+                mBlockSizes.push_back(size);
+                writeUnpack(mBlockCode, type, value);
+            }
+            return;
+        }
+
+        switch (type.kind) {
+        case Type::Kind::STRING: {
+            const std::string size = readSize();
+            mCode.line(FDCODEC + "read(store, " + value + ", " + size + ");");
+            break;
+        }
+        case Type::Kind::STRUCT:
+            flush();
+            mCode.line(value + ".decodeFD(store);");
+            break;
+        case Type::Kind::VECTOR: {
+            const std::string size = readSize();
+            if (type.element->kind == Type::Kind::SCALAR) {
+                mCode.line(FDCODEC + "read(store, " + value + ", " + size + ");");
+            } else if (type.element->isFixedSize()) {
+                const std::string buffer = newName("buffer");
+                mCode.line("std::string " + buffer + ";");
+                mCode.line(FDCODEC + "read(store, " + buffer + ", " + size + " * (" +
+                           getFixedSize(*type.element) + "));");
+                mCode.line(value + ".resize(" + size + ");");
+                const std::string item = newName("v");
+                mCode.open("{");
+                mCode.line("const char* in = " + buffer + ".data();");
+                mCode.open("for (auto& " + item + " : " + value + ") {");
+                writeUnpack(mCode, *type.element, item);
+                mCode.close();
+                mCode.close();
+            } else {
+                mCode.line(value + ".resize(" + size + ");");
+                writeDecodeLoop(*type.element, value);
+            }
+            break;
+        }
+        case Type::Kind::ARRAY:
+            flush();
+            writeDecodeLoop(*type.element, value);
+            break;
+        case Type::Kind::MAP: {
+            const std::string size = readSize();
+            const std::string index = newName("i");
+            const std::string item = newName("v");
+            mCode.open("for (" + SIZE_T + " " + index + " = 0; " + index + " < " + size + "; ++" + index + ") {");
+            mCode.line("std::pair<std::string, " + type.element->getCppName() + "> " + item + ";");
+            Type key;
+            key.kind = Type::Kind::STRING;
+            writeDecode(key, item + ".first");
+            writeDecode(*type.element, item + ".second");
+            flush();
+            mCode.line(value + ".insert(std::move(" + item + "));");
+            mCode.close();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    /**
+     * Reads the collected fixed size values
+     */
+    void flush()
+    {
+        if (mBlockSizes.empty()) {
+            return;
+        }
+
+        const std::string block = newName("block");
+        mCode.open("{");
+        mCode.line("char " + block + "[" + join(mBlockSizes, " + ") + "];");
+        mCode.line("store.read(" + block + ", sizeof(" + block + "));");
+        mCode.line("const char* in = " + block + ";");
+        mCode.append(mBlockCode);
+        mCode.close();
+
+        mBlockSizes.clear();
+        mBlockCode = Code();
+    }
+
+private:
+    const Schema& mSchema;
+    Code& mCode;
+    unsigned int mCounter;
+    std::vector<std::string> mBlockSizes;
+    Code mBlockCode;
+
+    std::string newName(const std::string& prefix)
+    {
+        return prefix + std::to_string(mCounter++);
+    }
+
+    const Struct& getStruct(const std::string& name) const
+    {
+        for (const Struct& definition : mSchema.structs) {
+            if (definition.name == name) {
+                return definition;
+            }
+        }
+        throw std::logic_error("Unknown structure " + name);
+    }
+
+    /**
+     * Adds the size prefix to the block and reads the block
+     */
+    std::string readSize()
+    {
+        const std::string size = newName("size");
+        mCode.line(SIZE_T + " " + size + ";");
+        if (mBlockSizes.empty()) {
+            mCode.line("store.read(&" + size + ", sizeof(" + size + "));");
+            return size;
+        }
+        mBlockSizes.push_back("sizeof(" + SIZE_T + ")");
+        mBlockCode.line("in = " + FDCODEC + "get(in, " + size + ");");
+        flush();
+        return size;
+    }
+
+    void writeSizeLoop(const Type& element, const std::string& value)
+    {
+        const std::string item = newName("v");
+        mCode.open("for (const auto& " + item + " : " + value + ") {");
+        writeSize(element, item);
+        mCode.close();
+    }
+
+    void writeEncodeElements(const Type& element, const std::string& value)
+    {
+        if (element.kind == Type::Kind::SCALAR) {
+            mCode.line("out = " + FDCODEC + "put(out, " + value + ".data(), " + value + ".size());");
+            return;
+        }
+
+        const std::string item = newName("v");
+        mCode.open("for (const auto& " + item + " : " + value + ") {");
+        writeEncode(element, item);
+        mCode.close();
+    }
+
+    void writeDecodeLoop(const Type& element, const std::string& value)
+    {
+        const std::string item = newName("v");
+        mCode.open("for (auto& " + item + " : " + value + ") {");
+        writeDecode(element, item);
+        flush();
+        mCode.close();
+    }
+};
+
+void writeEnum(Code& code, const Enum& definition)
+{
+    code.open("enum class " + definition.name + " : " + definition.underlyingType.name + " {");
+    for (std::size_t i = 0; i < definition.values.size(); ++i) {
+        code.line(definition.values[i].first + " = " + definition.values[i].second +
+                  (i + 1 < definition.values.size() ? "," : ""));
+    }
+    code.close("};");
+}
+
+void writeStruct(Code& code, const Struct& definition)
+{
+    code.open("struct " + definition.name + " {");
+    for (const Field& field : definition.fields) {
+        code.line(field.type.getCppName() + " " + field.name + ";");
+    }
+    if (!definition.fields.empty()) {
+        code.line("");
+    }
+
+    if (definition.fields.empty()) {
+        code.line("CARGO_REGISTER_EMPTY");
+    } else {
+        code.line("CARGO_REGISTER");
+        code.line("(");
+        for (std::size_t i = 0; i < definition.fields.size(); ++i) {
+            code.line("    " + definition.fields[i].name + (i + 1 < definition.fields.size() ? "," : ""));
+        }
+        code.line(")");
+    }
+
+    code.line("");
+    code.line(SIZE_T + " getFDSize() const;");
+    code.line("char* encodeFD(char* out) const;");
+    code.line("void decodeFD(::cargo::internals::FDStore& store);");
+    if (definition.isFixedSize) {
+        code.line("const char* decodeFD(const char* in);");
+    }
+    code.close("};");
+}
+
+void writeDefinitions(Code& code, const Schema& schema, const Struct& definition)
+{
+    Type type;
+    type.kind = Type::Kind::STRUCT;
+    type.name = definition.name;
+    type.isFixedStruct = definition.isFixedSize;
+
+    // Size
+    code.line("inline " + SIZE_T + " " + definition.name + "::getFDSize() const");
+    code.open("{");
+    {
+        FunctionWriter writer(schema, code);
+        if (definition.isFixedSize) {
+            code.line("return " + writer.getFixedSize(type) + ";");
+        } else {
+            std::vector<std::string> sizes;
+            for (const Field& field : definition.fields) {
+                if (field.type.isFixedSize()) {
+                    addSize(sizes, writer.getFixedSize(field.type));
+                }
+            }
+            code.line(SIZE_T + " size = " + (sizes.empty() ? "0" : join(sizes, " + ")) + ";");
+            for (const Field& field : definition.fields) {
+                if (!field.type.isFixedSize()) {
+                    writer.writeSize(field.type, "this->" + field.name);
+                }
+            }
+            code.line("return size;");
+        }
+    }
+    code.close();
+    code.line("");
+
+    // Encoding
+    code.line("inline char* " + definition.name + "::encodeFD(char* out) const");
+    code.open("{");
+    {
+        FunctionWriter writer(schema, code);
+        for (const Field& field : definition.fields) {
+            writer.writeEncode(field.type, "this->" + field.name);
+        }
+        code.line("return out;");
+    }
+    code.close();
+    code.line("");
+
+    // Decoding
+    if (definition.isFixedSize && FunctionWriter(schema, code).getFixedSize(type) == "0") {
+        code.line("inline void " + definition.name + "::decodeFD(::cargo::internals::FDStore&)");
+        code.open("{");
+    } else if (definition.isFixedSize) {
+        FunctionWriter writer(schema, code);
+        code.line("inline void " + definition.name + "::decodeFD(::cargo::internals::FDStore& store)");
+        code.open("{");
+        code.line("char block[" + writer.getFixedSize(type) + "];");
+        code.line("store.read(block, sizeof(block));");
+        code.line("decodeFD(block);");
+    } else {
+        code.line("inline void " + definition.name + "::decodeFD(::cargo::internals::FDStore& store)");
+        code.open("{");
+        FunctionWriter writer(schema, code);
+        for (const Field& field : definition.fields) {
+            writer.writeDecode(field.type, "this->" + field.name);
+        }
+        writer.flush();
+    }
+    code.close();
+
+    if (definition.isFixedSize) {
+        code.line("");
+        code.line("inline const char* " + definition.name + "::decodeFD(const char* in)");
+        code.open("{");
+        FunctionWriter writer(schema, code);
+        for (const Field& field : definition.fields) {
+            writer.writeUnpack(code, field.type, "this->" + field.name);
+        }
+        code.line("return in;");
+        code.close();
+    }
+}
+
+} // namespace
+
+std::string generate(const Schema& schema, const std::string& idlName, const std::string& guard)
+{
+    Code code;
+    code.line("// Generated by cargo-fd-codegen from " + idlName + ", do not edit");
+    code.line("");
+    code.line("#ifndef " + guard);
+    code.line("#define " + guard);
+    code.line("");
+    code.line("#include \"cargo/fields.hpp\"");
+    code.line("#include \"cargo-fd/internals/fd-codec.hpp\"");
+    code.line("");
+    code.line("#include <array>");
+    code.line("#include <cstddef>");
+    code.line("#include <cstdint>");
+    code.line("#include <map>");
+    code.line("#include <string>");
+    code.line("#include <utility>");
+    code.line("#include <vector>");
+    code.line("");
+
+    for (const std::string& name : schema.namespaces) {
+        code.line("namespace " + name + " {");
+    }
+    if (!schema.namespaces.empty()) {
+        code.line("");
+    }
+
+    for (const auto& definition : schema.order) {
+        if (definition.first == Schema::Kind::ENUM) {
+            writeEnum(code, schema.enums[definition.second]);
+        } else {
+            writeStruct(code, schema.structs[definition.second]);
+        }
+        code.line("");
+    }
+
+    for (const Struct& definition : schema.structs) {
+        writeDefinitions(code, schema, definition);
+        code.line("");
+    }
+
+    for (auto it = schema.namespaces.rbegin(); it != schema.namespaces.rend(); ++it) {
+        code.line("} // namespace " + *it);
+    }
+    if (!schema.namespaces.empty()) {
+        code.line("");
+    }
+
+    code.line("#endif // " + guard);
+
+    std::ostringstream out;
+    code.write(out);
+    return out.str();
+}
+
+} // namespace codegen
+
+} // namespace cargo
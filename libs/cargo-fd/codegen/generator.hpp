@@ -0,0 +1,50 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Writes the C++ header for the structures read from the IDL
+ */
+
+#ifndef CARGO_FD_CODEGEN_GENERATOR_HPP
+#define CARGO_FD_CODEGEN_GENERATOR_HPP
+
+#include "idl.hpp"
+
+#include <string>
+
+namespace cargo {
+
+namespace codegen {
+
+/**
+ * Generates the header with the structures, their CARGO_REGISTER and
+ * encoders/decoders of the cargo-fd format with no visitor recursion.
+ *
+ * @param schema parsed IDL
+ * @param idlName name of the IDL file, written in the header's comment
+ * @param guard name of the include guard
+ * @return content of the header
+ */
+std::string generate(const Schema& schema, const std::string& idlName, const std::string& guard);
+
+} // namespace codegen
+
+} // namespace cargo
+
+#endif // CARGO_FD_CODEGEN_GENERATOR_HPP
@@ -0,0 +1,386 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Parser of the cargo-fd-codegen IDL
+ */
+
+#include "config.hpp"
+
+#include "idl.hpp"
+
+#include <cctype>
+#include <map>
+
+namespace cargo {
+
+namespace codegen {
+
+namespace {
+
+const std::map<std::string, std::string> SCALARS = {
+    {"int8", "std::int8_t"},
+    {"int16", "std::int16_t"},
+    {"int32", "std::int32_t"},
+    {"int64", "std::int64_t"},
+    {"uint8", "std::uint8_t"},
+    {"uint16", "std::uint16_t"},
+    {"uint32", "std::uint32_t"},
+    {"uint64", "std::uint64_t"},
+    {"float", "float"},
+    {"double", "double"},
+    {"bool", "bool"}
+};
+
+struct Token {
+    enum class Kind {
+        IDENTIFIER,
+        NUMBER,
+        SYMBOL,
+        END
+    };
+
+    Kind kind;
+    std::string text;
+    unsigned int line;
+};
+
+std::vector<Token> tokenize(const std::string& text)
+{
+    std::vector<Token> tokens;
+    unsigned int line = 1;
+    std::size_t i = 0;
+    while (i < text.size()) {
+        const char c = text[i];
+        if (c == '\n') {
+            ++line;
+            ++i;
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+        } else if (text.compare(i, 2, "//") == 0) {
+            i = text.find('\n', i);
+            if (i == std::string::npos) {
+                i = text.size();
+            }
+        } else if (text.compare(i, 2, "/*") == 0) {
+            const std::size_t end = text.find("*/", i + 2);
+            if (end == std::string::npos) {
+                throw IdlException("Unterminated comment", line);
+            }
+            for (; i < end; ++i) {
+                if (text[i] == '\n') {
+                    ++line;
+                }
+            }
+            i = end + 2;
+        } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            const std::size_t begin = i;
+            while (i < text.size() && (std::isalnum(static_cast<unsigned char>(text[i])) || text[i] == '_')) {
+                ++i;
+            }
+            tokens.push_back({Token::Kind::IDENTIFIER, text.substr(begin, i - begin), line});
+        } else if (std::isdigit(static_cast<unsigned char>(c)) || c == '-') {
+            const std::size_t begin = i++;
+            while (i < text.size() && std::isalnum(static_cast<unsigned char>(text[i]))) {
+                ++i;
+            }
+            tokens.push_back({Token::Kind::NUMBER, text.substr(begin, i - begin), line});
+        } else if (text.compare(i, 2, "::") == 0) {
+            tokens.push_back({Token::Kind::SYMBOL, "::", line});
+            i += 2;
+        } else if (std::string(";{}<>,:=").find(c) != std::string::npos) {
+            tokens.push_back({Token::Kind::SYMBOL, std::string(1, c), line});
+            ++i;
+        } else {
+            throw IdlException(std::string("Unexpected character '") + c + "'", line);
+        }
+    }
+    tokens.push_back({Token::Kind::END, "end of file", line});
+    return tokens;
+}
+
+class Parser {
+public:
+    explicit Parser(const std::string& text)
+        : mTokens(tokenize(text)),
+          mPosition(0)
+    {
+    }
+
+    Schema parse()
+    {
+        while (peek().kind != Token::Kind::END) {
+            const Token& keyword = expectIdentifier();
+            if (keyword.text == "namespace") {
+                parseNamespace(keyword);
+            } else if (keyword.text == "enum") {
+                parseEnum();
+            } else if (keyword.text == "struct") {
+                parseStruct();
+            } else {
+                throw IdlException("Expected namespace, enum or struct, got '" + keyword.text + "'",
+                                   keyword.line);
+            }
+        }
+        return std::move(mSchema);
+    }
+
+private:
+    std::vector<Token> mTokens;
+    std::size_t mPosition;
+    Schema mSchema;
+    std::map<std::string, std::pair<Schema::Kind, std::size_t>> mDefinitions;
+
+    const Token& peek() const
+    {
+        return mTokens[mPosition];
+    }
+
+    const Token& next()
+    {
+        const Token& token = mTokens[mPosition];
+        if (token.kind != Token::Kind::END) {
+            ++mPosition;
+        }
+        return token;
+    }
+
+    bool accept(const std::string& symbol)
+    {
+        if (peek().kind == Token::Kind::SYMBOL && peek().text == symbol) {
+            next();
+            return true;
+        }
+        return false;
+    }
+
+    void expect(const std::string& symbol)
+    {
+        const Token& token = next();
+        if (token.kind != Token::Kind::SYMBOL || token.text != symbol) {
+            throw IdlException("Expected '" + symbol + "', got '" + token.text + "'", token.line);
+        }
+    }
+
+    const Token& expectIdentifier()
+    {
+        const Token& token = next();
+        if (token.kind != Token::Kind::IDENTIFIER) {
+            throw IdlException("Expected a name, got '" + token.text + "'", token.line);
+        }
+        return token;
+    }
+
+    const Token& expectNumber()
+    {
+        const Token& token = next();
+        if (token.kind != Token::Kind::NUMBER) {
+            throw IdlException("Expected a number, got '" + token.text + "'", token.line);
+        }
+        return token;
+    }
+
+    const Token& expectNewName()
+    {
+        const Token& token = expectIdentifier();
+        if (mDefinitions.count(token.text) != 0 || SCALARS.count(token.text) != 0) {
+            throw IdlException("'" + token.text + "' is already defined", token.line);
+        }
+        return token;
+    }
+
+    void parseNamespace(const Token& keyword)
+    {
+        if (!mSchema.namespaces.empty()) {
+            throw IdlException("Only one namespace can be given", keyword.line);
+        }
+        do {
+            mSchema.namespaces.push_back(expectIdentifier().text);
+        } while (accept("::"));
+        expect(";");
+    }
+
+    void parseEnum()
+    {
+        Enum definition;
+        definition.name = expectNewName().text;
+
+        expect(":");
+        const Token& underlying = expectIdentifier();
+        auto it = SCALARS.find(underlying.text);
+        if (it == SCALARS.end() || underlying.text == "float" ||
+            underlying.text == "double" || underlying.text == "bool") {
+            throw IdlException("Underlying type of an enum has to be an integer", underlying.line);
+        }
+        definition.underlyingType.kind = Type::Kind::SCALAR;
+        definition.underlyingType.name = it->second;
+
+        expect("{");
+        while (!accept("}")) {
+            const std::string name = expectIdentifier().text;
+            expect("=");
+            definition.values.emplace_back(name, expectNumber().text);
+            if (!accept(",")) {
+                expect("}");
+                break;
+            }
+        }
+        accept(";");
+
+        mDefinitions[definition.name] = std::make_pair(Schema::Kind::ENUM, mSchema.enums.size());
+        mSchema.order.emplace_back(Schema::Kind::ENUM, mSchema.enums.size());
+        mSchema.enums.push_back(std::move(definition));
+    }
+
+    void parseStruct()
+    {
+        Struct definition;
+        definition.name = expectNewName().text;
+        definition.isFixedSize = true;
+
+        expect("{");
+        while (!accept("}")) {
+            Field field;
+            field.type = parseType();
+            const Token& name = expectIdentifier();
+            for (const Field& other : definition.fields) {
+                if (other.name == name.text) {
+                    throw IdlException("Field '" + name.text + "' is already defined", name.line);
+                }
+            }
+            field.name = name.text;
+            expect(";");
+
+            definition.isFixedSize = definition.isFixedSize && field.type.isFixedSize();
+            definition.fields.push_back(std::move(field));
+        }
+        accept(";");
+
+        mDefinitions[definition.name] = std::make_pair(Schema::Kind::STRUCT, mSchema.structs.size());
+        mSchema.order.emplace_back(Schema::Kind::STRUCT, mSchema.structs.size());
+        mSchema.structs.push_back(std::move(definition));
+    }
+
+    Type parseType()
+    {
+        const Token& name = expectIdentifier();
+
+        Type type;
+        auto scalarIt = SCALARS.find(name.text);
+        if (scalarIt != SCALARS.end()) {
+            type.kind = Type::Kind::SCALAR;
+            type.name = scalarIt->second;
+        } else if (name.text == "string") {
+            type.kind = Type::Kind::STRING;
+        } else if (name.text == "vector") {
+            type.kind = Type::Kind::VECTOR;
+            expect("<");
+            type.element = std::make_shared<Type>(parseType());
+            expect(">");
+            if (type.element->kind == Type::Kind::SCALAR && type.element->name == "bool") {
+                throw IdlException("vector<bool> isn't supported", name.line);
+            }
+        } else if (name.text == "array") {
+            type.kind = Type::Kind::ARRAY;
+            expect("<");
+            type.element = std::make_shared<Type>(parseType());
+            expect(",");
+            const Token& size = expectNumber();
+            try {
+                type.arraySize = std::stoul(size.text);
+            } catch (const std::exception&) {
+                throw IdlException("Bad array size '" + size.text + "'", size.line);
+            }
+            expect(">");
+        } else if (name.text == "map") {
+            type.kind = Type::Kind::MAP;
+            expect("<");
+            const Token& key = expectIdentifier();
+            if (key.text != "string") {
+                throw IdlException("Keys of a map have to be strings", key.line);
+            }
+            expect(",");
+            type.element = std::make_shared<Type>(parseType());
+            expect(">");
+        } else {
+            auto it = mDefinitions.find(name.text);
+            if (it == mDefinitions.end()) {
+                throw IdlException("Unknown type '" + name.text + "'", name.line);
+            }
+            type.name = name.text;
+            if (it->second.first == Schema::Kind::ENUM) {
+                type.kind = Type::Kind::ENUM;
+                type.element = std::make_shared<Type>(mSchema.enums[it->second.second].underlyingType);
+            } else {
+                type.kind = Type::Kind::STRUCT;
+                type.isFixedStruct = mSchema.structs[it->second.second].isFixedSize;
+            }
+        }
+        return type;
+    }
+};
+
+} // namespace
+
+Type::Type()
+    : kind(Kind::SCALAR),
+      arraySize(0),
+      isFixedStruct(false)
+{
+}
+
+bool Type::isFixedSize() const
+{
+    switch (kind) {
+    case Kind::SCALAR:
+    case Kind::ENUM:
+        return true;
+    case Kind::STRUCT:
+        return isFixedStruct;
+    case Kind::ARRAY:
+        return element->isFixedSize();
+    default:
+        return false;
+    }
+}
+
+std::string Type::getCppName() const
+{
+    switch (kind) {
+    case Kind::STRING:
+        return "std::string";
+    case Kind::VECTOR:
+        return "std::vector<" + element->getCppName() + ">";
+    case Kind::ARRAY:
+        return "std::array<" + element->getCppName() + ", " + std::to_string(arraySize) + ">";
+    case Kind::MAP:
+        return "std::map<std::string, " + element->getCppName() + ">";
+    default:
+        return name;
+    }
+}
+
+Schema parse(const std::string& text)
+{
+    return Parser(text).parse();
+}
+
+} // namespace codegen
+
+} // namespace cargo
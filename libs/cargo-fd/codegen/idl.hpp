@@ -0,0 +1,165 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Description of the structures read by cargo-fd-codegen
+ *
+ * Example of the IDL:
+ *
+ *     namespace cargo::example;
+ *
+ *     // Values of enums are written as the underlying type
+ *     enum Priority : uint8 {
+ *         LOW = 0,
+ *         HIGH = 1
+ *     }
+ *
+ *     struct Point {
+ *         int32 x;
+ *         int32 y;
+ *     }
+ *
+ *     struct Message {
+ *         uint64 id;
+ *         string text;
+ *         Priority priority;
+ *         vector<Point> points;
+ *         array<double, 3> position;
+ *         map<string, Point> named;
+ *     }
+ *
+ * Types:
+ *  - int8, int16, int32, int64, uint8, uint16, uint32, uint64, float, double, bool
+ *  - string
+ *  - enums and structures defined earlier in the file
+ *  - vector<T>, array<T, N>, map<string, T>
+ */
+
+#ifndef CARGO_FD_CODEGEN_IDL_HPP
+#define CARGO_FD_CODEGEN_IDL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cargo {
+
+namespace codegen {
+
+struct IdlException: public std::runtime_error {
+    IdlException(const std::string& message, const unsigned int line)
+        : std::runtime_error(message),
+          line(line)
+    {
+    }
+
+    unsigned int line;
+};
+
+struct Type {
+    enum class Kind {
+        SCALAR,
+        STRING,
+        ENUM,
+        STRUCT,
+        VECTOR,
+        ARRAY,
+        MAP
+    };
+
+    Kind kind;
+
+    /**
+     * C++ type of a scalar, name of an enum or a structure
+     */
+    std::string name;
+
+    /**
+     * Type of the elements of a vector or an array, the values of a map, the underlying type of an enum
+     */
+    std::shared_ptr<Type> element;
+
+    std::size_t arraySize;
+
+    /**
+     * The structure has only fixed size fields (see isFixedSize)
+     */
+    bool isFixedStruct;
+
+    Type();
+
+    /**
+     * @return true if the encoded size doesn't depend on the value
+     */
+    bool isFixedSize() const;
+
+    /**
+     * @return C++ type
+     */
+    std::string getCppName() const;
+};
+
+struct Field {
+    Type type;
+    std::string name;
+};
+
+struct Struct {
+    std::string name;
+    std::vector<Field> fields;
+    bool isFixedSize;
+};
+
+struct Enum {
+    std::string name;
+    Type underlyingType;
+    std::vector<std::pair<std::string, std::string>> values;
+};
+
+struct Schema {
+    std::vector<std::string> namespaces;
+    std::vector<Enum> enums;
+    std::vector<Struct> structs;
+
+    /**
+     * Definitions in the order of the IDL file
+     */
+    enum class Kind {
+        ENUM,
+        STRUCT
+    };
+    std::vector<std::pair<Kind, std::size_t>> order;
+};
+
+/**
+ * Parses the IDL
+ *
+ * @param text content of the IDL file
+ * @return parsed definitions
+ * @throw IdlException on syntax errors
+ */
+Schema parse(const std::string& text);
+
+} // namespace codegen
+
+} // namespace cargo
+
+#endif // CARGO_FD_CODEGEN_IDL_HPP
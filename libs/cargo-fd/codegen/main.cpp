@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Generates structures with their cargo-fd encoders from an IDL file
+ *
+ * Usage: cargo-fd-codegen IDL_FILE HEADER
+ */
+
+#include "config.hpp"
+
+#include "idl.hpp"
+#include "generator.hpp"
+
+#include <cctype>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace cargo::codegen;
+
+namespace {
+
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " IDL_FILE HEADER" << std::endl
+              << "Writes the structures described in the IDL_FILE to the C++ HEADER." << std::endl;
+}
+
+std::string getFileName(const std::string& path)
+{
+    const std::size_t slash = path.rfind('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+std::string getGuard(const std::string& path)
+{
+    std::string guard = "CARGO_FD_CODEGEN_";
+    for (const char c : getFileName(path)) {
+        guard += std::isalnum(static_cast<unsigned char>(c)) ?
+                 static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : '_';
+    }
+    return guard;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::ifstream idlFile(argv[1]);
+    if (!idlFile) {
+        std::cerr << "Can't open " << argv[1] << std::endl;
+        return 1;
+    }
+    std::stringstream idl;
+    idl << idlFile.rdbuf();
+
+    std::string header;
+    try {
+        header = generate(parse(idl.str()), getFileName(argv[1]), getGuard(argv[2]));
+    } catch (const IdlException& e) {
+        std::cerr << argv[1] << ":" << e.line << ": error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream headerFile(argv[2]);
+    if (!(headerFile << header)) {
+        std::cerr << "Can't write " << argv[2] << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   File descriptors passed with one message
+ */
+
+#include "config.hpp"
+
+#include "cargo-fd/internals/fd-batch.hpp"
+#include "cargo/exception.hpp"
+
+#include <unistd.h>
+
+namespace cargo {
+
+namespace internals {
+
+FDSendBatch::FDSendBatch(int fd)
+    : mStore(fd),
+      mTail(fd),
+      mPreviousBufferPtr(nullptr),
+      mIsHolding(false)
+{
+}
+
+FDSendBatch::~FDSendBatch()
+{
+    stopHolding();
+}
+
+void FDSendBatch::add(int fd)
+{
+    if (mFDs.empty()) {
+        // Hold back the data that follows
+        mPreviousBufferPtr = FDWriteBuffer::exchangeCurrent(&mTail);
+        mIsHolding = true;
+    }
+    mFDs.push_back(fd);
+}
+
+void FDSendBatch::send(const unsigned int timeoutMS)
+{
+    if (mFDs.empty()) {
+        return;
+    }
+
+    stopHolding();
+    try {
+        mStore.sendFDs(mFDs, mTail.data(), mTail.size(), timeoutMS);
+    } catch (...) {
+        mFDs.clear();
+        mTail.clear();
+        throw;
+    }
+    mFDs.clear();
+    mTail.clear();
+}
+
+void FDSendBatch::stopHolding()
+{
+    if (mIsHolding) {
+        FDWriteBuffer::exchangeCurrent(mPreviousBufferPtr);
+        mIsHolding = false;
+    }
+}
+
+FDReceiveBatch::FDReceiveBatch(int fd)
+    : mStore(fd),
+      mNextIndex(0),
+      mIsReceived(false)
+{
+}
+
+FDReceiveBatch::~FDReceiveBatch()
+{
+    for (size_t i = mNextIndex; i < mFDs.size(); ++i) {
+        ::close(mFDs[i]);
+    }
+}
+
+int FDReceiveBatch::take(const unsigned int timeoutMS)
+{
+    if (!mIsReceived) {
+        mIsReceived = true;
+        mStore.receiveFDs(mFDs, timeoutMS);
+    }
+
+    if (mNextIndex == mFDs.size()) {
+        throw CargoException("No more file descriptors in the message");
+    }
+    return mFDs[mNextIndex++];
+}
+
+} // namespace internals
+
+} // namespace cargo
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   File descriptors passed with one message
+ */
+
+#ifndef CARGO_FD_INTERNALS_FD_BATCH_HPP
+#define CARGO_FD_INTERNALS_FD_BATCH_HPP
+
+#include "cargo-fd/internals/fdstore.hpp"
+#include "cargo-fd/internals/fd-write-buffer.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Collects the file descriptors of one message, so that all of them are passed with one sendmsg.
+ *
+ * The data written after the first file descriptor is held back and attached to the descriptors.
+ * The reader gets everything with one FDReceiveBatch::take call.
+ */
+class FDSendBatch {
+public:
+    /**
+     * @param fd file descriptor of the UNIX socket
+     */
+    explicit FDSendBatch(int fd);
+    ~FDSendBatch();
+
+    FDSendBatch(const FDSendBatch&) = delete;
+    FDSendBatch& operator=(const FDSendBatch&) = delete;
+
+    /**
+     * Adds a file descriptor to pass. The data written later is held back until send().
+     */
+    void add(int fd);
+
+    /**
+     * Passes the collected file descriptors and writes the data held back.
+     * Does nothing if no file descriptor was added.
+     *
+     * @param timeoutMS timeout in milliseconds
+     */
+    void send(const unsigned int timeoutMS = maxTimeout);
+
+private:
+    FDStore mStore;
+    std::vector<int> mFDs;
+    FDWriteBuffer mTail;
+    FDWriteBuffer* mPreviousBufferPtr;
+    bool mIsHolding;
+
+    void stopHolding();
+};
+
+/**
+ * Receives the file descriptors passed with FDSendBatch.
+ *
+ * The descriptors that weren't taken are closed in the destructor.
+ */
+class FDReceiveBatch {
+public:
+    /**
+     * @param fd file descriptor of the UNIX socket
+     */
+    explicit FDReceiveBatch(int fd);
+    ~FDReceiveBatch();
+
+    FDReceiveBatch(const FDReceiveBatch&) = delete;
+    FDReceiveBatch& operator=(const FDReceiveBatch&) = delete;
+
+    /**
+     * The first call receives all file descriptors of the message.
+     *
+     * @param timeoutMS timeout in milliseconds
+     * @return next file descriptor of the message
+     */
+    int take(const unsigned int timeoutMS = maxTimeout);
+
+private:
+    FDStore mStore;
+    std::vector<int> mFDs;
+    size_t mNextIndex;
+    bool mIsReceived;
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FD_BATCH_HPP
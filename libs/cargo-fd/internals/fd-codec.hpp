@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Helpers for the encoders generated by cargo-fd-codegen
+ */
+
+#ifndef CARGO_FD_INTERNALS_FD_CODEC_HPP
+#define CARGO_FD_INTERNALS_FD_CODEC_HPP
+
+#include "cargo-fd/internals/fdstore.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Structures generated by cargo-fd-codegen encode and decode themselves in the cargo-fd format.
+ * The layout is the same as the one written by ToFDStoreVisitor.
+ */
+template <typename T>
+struct hasFDCodecHelper__ {
+    template <typename C> static std::true_type
+    test(decltype(std::declval<const C>().encodeFD(static_cast<char*>(nullptr)))*);
+
+    template <typename C> static std::false_type
+    test(...);
+
+    static constexpr bool value = std::is_same<decltype(test<T>(0)), std::true_type>::value;
+};
+
+template <typename T>
+struct hasFDCodec : public std::integral_constant<bool, hasFDCodecHelper__<T>::value> {};
+
+namespace fdcodec {
+
+// Encodings up to this size are prepared on the stack
+const std::size_t STACK_BUFFER_SIZE = 1024;
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline char* put(char* out, const T& value)
+{
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+template<typename T>
+inline char* put(char* out, const T* values, const std::size_t size)
+{
+    std::memcpy(out, values, size * sizeof(T));
+    return out + size * sizeof(T);
+}
+
+inline char* put(char* out, const std::string& value)
+{
+    out = put(out, value.size());
+    std::memcpy(out, value.data(), value.size());
+    return out + value.size();
+}
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline const char* get(const char* in, T& value)
+{
+    std::memcpy(&value, in, sizeof(T));
+    return in + sizeof(T);
+}
+
+template<typename T>
+inline const char* get(const char* in, T* values, const std::size_t size)
+{
+    std::memcpy(values, in, size * sizeof(T));
+    return in + size * sizeof(T);
+}
+
+/**
+ * Reads the characters of a string which size was already read
+ */
+inline void read(FDStore& store, std::string& value, const std::size_t size)
+{
+    value.resize(size);
+    if (size > 0) {
+        store.read(&value.front(), size);
+    }
+}
+
+inline void read(FDStore& store, std::string& value)
+{
+    std::size_t size;
+    store.read(&size, sizeof(size));
+    read(store, value, size);
+}
+
+/**
+ * Reads the elements of a vector which size was already read
+ */
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline void read(FDStore& store, std::vector<T>& values, const std::size_t size)
+{
+    values.resize(size);
+    if (size > 0) {
+        store.read(values.data(), size * sizeof(T));
+    }
+}
+
+template<typename Cargo>
+void save(const int fd, const Cargo& visitable)
+{
+    const std::size_t size = visitable.getFDSize();
+    if (size <= STACK_BUFFER_SIZE) {
+        char buffer[STACK_BUFFER_SIZE];
+        visitable.encodeFD(buffer);
+        FDStore(fd).write(buffer, size);
+    } else {
+        std::unique_ptr<char[]> buffer(new char[size]);
+        visitable.encodeFD(buffer.get());
+        FDStore(fd).write(buffer.get(), size);
+    }
+}
+
+template<typename Cargo>
+void load(const int fd, Cargo& visitable)
+{
+    FDStore store(fd);
+    visitable.decodeFD(store);
+}
+
+} // namespace fdcodec
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FD_CODEC_HPP
@@ -0,0 +1,62 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Compact binary format of cargo-fd, integers as varints
+ */
+
+#include "config.hpp"
+
+#include "cargo-fd/internals/fd-compact.hpp"
+#include "cargo/exception.hpp"
+
+namespace cargo {
+
+namespace internals {
+
+namespace compact {
+
+void throwOutOfRange()
+{
+    throw CargoException("Varint out of range of the field type");
+}
+
+std::uint64_t getLongVarint(MessageInput& input)
+{
+    std::uint64_t value = 0;
+    for (unsigned int shift = 0; shift < 7 * MAX_VARINT_SIZE; shift += 7) {
+        const unsigned char byte = static_cast<unsigned char>(*input.skip(1));
+        if (shift == 7 * (MAX_VARINT_SIZE - 1) && byte > 1) {
+            // Only the lowest bit of the last byte fits in 64 bits
+            throwOutOfRange();
+        }
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            return value;
+        }
+    }
+    throw CargoException("Varint is too long");
+}
+
+} // namespace compact
+
+} // namespace internals
+
+} // namespace cargo
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Compact binary format of cargo-fd, integers as varints
+ */
+
+#ifndef CARGO_FD_INTERNALS_FD_COMPACT_HPP
+#define CARGO_FD_INTERNALS_FD_COMPACT_HPP
+
+#include "cargo-fd/internals/fd-message.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace cargo {
+
+namespace internals {
+
+namespace compact {
+
+/**
+ * The fields are written one after another, like with ToFDStoreVisitor, in a message (see MessageBuilder):
+ *  - integers wider than a byte are LEB128 varints, the signed ones zigzag encoded
+ *  - other arithmetic values are written as they are in memory
+ *  - sizes of strings, vectors and maps are varints
+ *  - unions are the position of the type in CARGO_DECLARE_UNION followed by the value
+ *  - FileDescriptor fields are the index of the passed descriptor
+ */
+template<typename T>
+struct isVarint : public std::integral_constant<bool, std::is_integral<T>::value && (sizeof(T) > 1)> {};
+
+const std::size_t MAX_VARINT_SIZE = 10;
+
+inline std::uint64_t encodeZigZag(const std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t decodeZigZag(const std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+template<typename T, typename std::enable_if<std::is_signed<T>::value, int>::type = 0>
+std::uint64_t toVarint(const T value)
+{
+    return encodeZigZag(value);
+}
+
+template<typename T, typename std::enable_if<!std::is_signed<T>::value, int>::type = 0>
+std::uint64_t toVarint(const T value)
+{
+    return value;
+}
+
+[[noreturn]] void throwOutOfRange();
+
+template<typename T, typename std::enable_if<std::is_signed<T>::value, int>::type = 0>
+T fromVarint(const std::uint64_t varint)
+{
+    const std::int64_t value = decodeZigZag(varint);
+    if (static_cast<std::int64_t>(static_cast<T>(value)) != value) {
+        throwOutOfRange();
+    }
+    return static_cast<T>(value);
+}
+
+template<typename T, typename std::enable_if<!std::is_signed<T>::value, int>::type = 0>
+T fromVarint(const std::uint64_t varint)
+{
+    if (static_cast<std::uint64_t>(static_cast<T>(varint)) != varint) {
+        throwOutOfRange();
+    }
+    return static_cast<T>(varint);
+}
+
+// Varints of one byte fit in any type
+template<typename T, typename std::enable_if<std::is_signed<T>::value, int>::type = 0>
+T fromVarintByte(const unsigned char varint)
+{
+    return static_cast<T>((varint >> 1) ^ -(varint & 1));
+}
+
+template<typename T, typename std::enable_if<!std::is_signed<T>::value, int>::type = 0>
+T fromVarintByte(const unsigned char varint)
+{
+    return static_cast<T>(varint);
+}
+
+inline void putVarint(MessageBuilder& output, std::uint64_t value)
+{
+    unsigned char buffer[MAX_VARINT_SIZE];
+    std::size_t size = 0;
+    while (value >= 0x80) {
+        buffer[size++] = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    buffer[size++] = static_cast<unsigned char>(value);
+    output.put(buffer, size);
+}
+
+std::uint64_t getLongVarint(MessageInput& input);
+
+inline std::uint64_t getVarint(MessageInput& input)
+{
+    if (!input.empty() && static_cast<unsigned char>(*input.data()) < 0x80) {
+        return static_cast<unsigned char>(*input.skip(1));
+    }
+    return getLongVarint(input);
+}
+
+/**
+ * Decodes count varints. With SSE2 the runs of one byte varints,
+ * the usual case for small numbers, are found 16 bytes at once.
+ */
+template<typename T>
+void getVarints(MessageInput& input, T* values, const std::size_t count)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    const std::size_t BLOCK_SIZE = sizeof(__m128i);
+    while (count - i >= BLOCK_SIZE && input.size() >= BLOCK_SIZE) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data()));
+        const unsigned int continuationMask = static_cast<unsigned int>(_mm_movemask_epi8(block));
+        const std::size_t run = continuationMask == 0 ? BLOCK_SIZE : __builtin_ctz(continuationMask);
+
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(input.skip(run));
+        for (std::size_t j = 0; j < run; ++j) {
+            values[i + j] = fromVarintByte<T>(bytes[j]);
+        }
+        i += run;
+
+        if (run != BLOCK_SIZE) {
+            values[i++] = fromVarint<T>(getLongVarint(input));
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        values[i] = fromVarint<T>(getVarint(input));
+    }
+}
+
+} // namespace compact
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FD_COMPACT_HPP
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Messages of cargo-fd written and read with one system call
+ */
+
+#include "config.hpp"
+
+#include "cargo-fd/internals/fd-message.hpp"
+#include "cargo-fd/internals/fdstore.hpp"
+#include "cargo/exception.hpp"
+#include "cargo/internals/lz4.hpp"
+
+#include <limits>
+#include <unistd.h>
+
+namespace cargo {
+
+namespace internals {
+
+namespace {
+
+thread_local bool gIsCompressionEnabled = false;
+
+// Bound of the LZ4 compression ratio, protects from allocating memory for forged sizes
+const std::size_t MAX_COMPRESSION_RATIO = 255;
+
+} // namespace
+
+CompressionScope::CompressionScope(const bool isEnabled)
+    : mWasEnabled(gIsCompressionEnabled)
+{
+    gIsCompressionEnabled = isEnabled;
+}
+
+CompressionScope::~CompressionScope()
+{
+    gIsCompressionEnabled = mWasEnabled;
+}
+
+bool CompressionScope::isEnabled()
+{
+    return gIsCompressionEnabled;
+}
+
+void MessageBuilder::endLength(const std::size_t position)
+{
+    const std::size_t size = mBuffer.size() - position - sizeof(std::uint32_t);
+    if (size > std::numeric_limits<std::uint32_t>::max()) {
+        throw CargoException("Value too big for a cargo-fd message: " + std::to_string(size));
+    }
+    const std::uint32_t size32 = static_cast<std::uint32_t>(size);
+    std::memcpy(&mBuffer[position], &size32, sizeof(size32));
+}
+
+void MessageBuilder::send(const int fd, const std::vector<int>& fds)
+{
+    const std::size_t dataSize = mBuffer.size() - HEADER_SIZE;
+    if (dataSize > MAX_MESSAGE_SIZE) {
+        throw CargoException("Message too big for cargo-fd: " + std::to_string(dataSize));
+    }
+
+    std::uint32_t flags = 0;
+    if (dataSize >= COMPRESSION_THRESHOLD && CompressionScope::isEnabled()) {
+        std::string compressed(HEADER_SIZE, '\0');
+        const std::uint32_t dataSize32 = static_cast<std::uint32_t>(dataSize);
+        compressed.append(reinterpret_cast<const char*>(&dataSize32), sizeof(dataSize32));
+        lz4::compress(mBuffer.data() + HEADER_SIZE, dataSize, compressed);
+        if (compressed.size() < mBuffer.size()) {
+            mBuffer.swap(compressed);
+            flags = COMPRESSED_FLAG;
+        }
+    }
+
+    const std::uint32_t header[] = {
+        static_cast<std::uint32_t>(mBuffer.size() - HEADER_SIZE),
+        static_cast<std::uint32_t>(fds.size()) | flags
+    };
+    std::memcpy(&mBuffer[0], header, HEADER_SIZE);
+
+    FDStore store(fd);
+    store.write(mBuffer.data(), mBuffer.size());
+    if (!fds.empty()) {
+        store.sendFDs(fds, nullptr, 0);
+    }
+}
+
+void MessageInput::throwTruncated()
+{
+    throw CargoException("Message data is truncated");
+}
+
+ReceivedMessage::ReceivedMessage(const int fd)
+{
+    FDStore store(fd);
+
+    std::uint32_t header[2];
+    store.read(header, sizeof(header));
+    const std::uint32_t fdCount = header[1] & ~MessageBuilder::COMPRESSED_FLAG;
+
+    // The size comes from the peer, don't let it allocate any amount of memory
+    if (header[0] > MAX_MESSAGE_SIZE) {
+        throw CargoException("Message too big for cargo-fd: " + std::to_string(header[0]));
+    }
+    mBuffer.resize(header[0]);
+    if (!mBuffer.empty()) {
+        store.read(&mBuffer.front(), mBuffer.size());
+    }
+
+    // The destructor doesn't run when the constructor throws, close the received descriptors here
+    try {
+        if (fdCount != 0) {
+            store.receiveFDs(mFDs);
+            if (mFDs.size() != fdCount) {
+                throw CargoException("Expected " + std::to_string(fdCount) +
+                                     " file descriptors, received " + std::to_string(mFDs.size()));
+            }
+        }
+
+        if (header[1] & MessageBuilder::COMPRESSED_FLAG) {
+            decompress();
+        }
+    } catch (...) {
+        for (const int received : mFDs) {
+            ::close(received);
+        }
+        throw;
+    }
+}
+
+void ReceivedMessage::decompress()
+{
+    std::uint32_t dataSize;
+    MessageInput input = getInput();
+    input.get(dataSize);
+    if (dataSize > MAX_MESSAGE_SIZE || dataSize / MAX_COMPRESSION_RATIO > input.size()) {
+        throw CargoException("Compressed message has a wrong size: " + std::to_string(dataSize));
+    }
+
+    std::string data(dataSize, '\0');
+    lz4::decompress(input.data(), input.size(), &data[0], data.size());
+    mBuffer.swap(data);
+}
+
+ReceivedMessage::~ReceivedMessage()
+{
+    for (const int fd : mFDs) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+}
+
+int ReceivedMessage::takeFD(const std::uint32_t index)
+{
+    if (index >= mFDs.size() || mFDs[index] < 0) {
+        throw CargoException("No file descriptor with index " + std::to_string(index));
+    }
+    const int fd = mFDs[index];
+    mFDs[index] = -1;
+    return fd;
+}
+
+} // namespace internals
+
+} // namespace cargo
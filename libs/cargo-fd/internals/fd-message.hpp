@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Messages of cargo-fd written and read with one system call
+ */
+
+#ifndef CARGO_FD_INTERNALS_FD_MESSAGE_HPP
+#define CARGO_FD_INTERNALS_FD_MESSAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Messages with less data are never compressed
+ */
+const std::size_t COMPRESSION_THRESHOLD = 512;
+
+/**
+ * Messages with more data, before compression, are neither sent nor received
+ */
+const std::size_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+/**
+ * Makes MessageBuilder::send compress the messages written in the calling thread
+ * for the lifetime of the Scope.
+ */
+class CompressionScope {
+public:
+    explicit CompressionScope(const bool isEnabled);
+    ~CompressionScope();
+
+    CompressionScope(const CompressionScope&) = delete;
+    CompressionScope& operator=(const CompressionScope&) = delete;
+
+    /**
+     * @return is a Scope enabling the compression active in the calling thread
+     */
+    static bool isEnabled();
+
+private:
+    bool mWasEnabled;
+};
+
+/**
+ * Message prepared in memory and written at once. It starts with a header:
+ *  - std::uint32_t size of the data
+ *  - std::uint32_t number of the file descriptors passed after the data,
+ *    COMPRESSED_FLAG is set when the data is compressed
+ *
+ * Compressed data is the std::uint32_t size of the original data followed by an LZ4 block.
+ * Sizes of nested values can be filled in when they're known, see beginLength.
+ */
+class MessageBuilder {
+public:
+    static const std::size_t HEADER_SIZE = 2 * sizeof(std::uint32_t);
+    static const std::uint32_t COMPRESSED_FLAG = 1U << 31;
+
+    MessageBuilder()
+        : mBuffer(HEADER_SIZE, '\0')
+    {
+    }
+
+    void put(const void* data, const std::size_t size)
+    {
+        mBuffer.append(static_cast<const char*>(data), size);
+    }
+
+    template<typename T>
+    void put(const T& value)
+    {
+        put(&value, sizeof(T));
+    }
+
+    /**
+     * Reserves a std::uint32_t size
+     *
+     * @return position of the size to fill in with endLength
+     */
+    std::size_t beginLength()
+    {
+        const std::size_t position = mBuffer.size();
+        mBuffer.append(sizeof(std::uint32_t), '\0');
+        return position;
+    }
+
+    /**
+     * Sets the reserved size to the size of the data put after it
+     */
+    void endLength(const std::size_t position);
+
+    /**
+     * Writes the message. The descriptors are passed after the data.
+     * Inside a CompressionScope the data is compressed if it's at least
+     * COMPRESSION_THRESHOLD bytes long and gets smaller.
+     */
+    void send(const int fd, const std::vector<int>& fds);
+
+private:
+    std::string mBuffer;
+};
+
+/**
+ * Data of a received message, with bounds checks
+ */
+class MessageInput {
+public:
+    MessageInput(const char* begin, const char* end)
+        : mPos(begin),
+          mEnd(end)
+    {
+    }
+
+    bool empty() const
+    {
+        return mPos == mEnd;
+    }
+
+    const char* data() const
+    {
+        return mPos;
+    }
+
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(mEnd - mPos);
+    }
+
+    void get(void* data, const std::size_t size)
+    {
+        std::memcpy(data, skip(size), size);
+    }
+
+    template<typename T>
+    void get(T& value)
+    {
+        get(&value, sizeof(T));
+    }
+
+    /**
+     * @return the skipped data
+     */
+    const char* skip(const std::size_t size)
+    {
+        if (size > this->size()) {
+            throwTruncated();
+        }
+        const char* data = mPos;
+        mPos += size;
+        return data;
+    }
+
+    /**
+     * @return the data of a value written between MessageBuilder::beginLength and endLength
+     */
+    MessageInput getNested()
+    {
+        std::uint32_t size;
+        get(size);
+        const char* data = skip(size);
+        return MessageInput(data, data + size);
+    }
+
+    [[noreturn]] static void throwTruncated();
+
+private:
+    const char* mPos;
+    const char* mEnd;
+};
+
+/**
+ * Message written by MessageBuilder::send.
+ * The passed descriptors that weren't taken are closed in the destructor.
+ */
+class ReceivedMessage {
+public:
+    /**
+     * Reads the whole message, compressed data is decompressed
+     */
+    explicit ReceivedMessage(const int fd);
+    ~ReceivedMessage();
+
+    ReceivedMessage(const ReceivedMessage&) = delete;
+    ReceivedMessage& operator=(const ReceivedMessage&) = delete;
+
+    MessageInput getInput() const
+    {
+        return MessageInput(mBuffer.data(), mBuffer.data() + mBuffer.size());
+    }
+
+    int takeFD(const std::uint32_t index);
+
+private:
+    std::string mBuffer;
+    std::vector<int> mFDs;
+
+    void decompress();
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FD_MESSAGE_HPP
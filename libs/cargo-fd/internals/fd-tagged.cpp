@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Tagged binary format of cargo-fd
+ */
+
+#include "config.hpp"
+
+#include "cargo-fd/internals/fd-tagged.hpp"
+#include "cargo/exception.hpp"
+
+namespace cargo {
+
+namespace internals {
+
+namespace tagged {
+
+void putTag(MessageBuilder& output, const std::size_t index, const WireType wireType)
+{
+    if (index >= MAX_FIELD_COUNT) {
+        throw CargoException("Too many fields for the tagged format: " + std::to_string(index + 1));
+    }
+    output.put(static_cast<std::uint16_t>(index << WIRE_TYPE_BITS | static_cast<std::uint16_t>(wireType)));
+}
+
+std::uint16_t peekTag(const MessageInput& input)
+{
+    std::uint16_t tag;
+    MessageInput(input).get(tag);
+    return tag;
+}
+
+void skipValue(MessageInput& input, const WireType wireType)
+{
+    switch (wireType) {
+    case WireType::FIXED8:
+        input.skip(1);
+        break;
+    case WireType::FIXED16:
+        input.skip(2);
+        break;
+    case WireType::FIXED32:
+        input.skip(4);
+        break;
+    case WireType::FIXED64:
+        input.skip(8);
+        break;
+    case WireType::LENGTH:
+        input.getNested();
+        break;
+    default:
+        throw CargoException("Unknown wire type: " + std::to_string(static_cast<int>(wireType)));
+    }
+}
+
+} // namespace tagged
+
+} // namespace internals
+
+} // namespace cargo
@@ -0,0 +1,239 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Tagged binary format of cargo-fd
+ */
+
+#ifndef CARGO_FD_INTERNALS_FD_TAGGED_HPP
+#define CARGO_FD_INTERNALS_FD_TAGGED_HPP
+
+#include "cargo-fd/internals/fd-message.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @ingroup libcargo-fd
+ *
+ * Makes saveToFD and loadFromFD use the tagged format for the structure.
+ *
+ * Every field is written with its position in CARGO_REGISTER and its wire type,
+ * so peers with different versions of the structure can talk to each other:
+ *  - fields unknown to the reader are skipped without parsing them
+ *  - fields missing in the data keep their current values
+ *  - new fields have to be added at the end of the CARGO_REGISTER,
+ *    fields can't be removed or reordered, only left unused
+ *  - fields of a CARGO_EXTEND base structure are numbered before the fields of the derived one,
+ *    so new fields can be added at the end of the CARGO_EXTEND too, but not to the base
+ *
+ * Example:
+ * @code
+ *   struct Foo
+ *   {
+ *       std::string bar;
+ *       std::vector<int> tab;
+ *
+ *       CARGO_REGISTER
+ *       (
+ *           bar,
+ *           tab
+ *       )
+ *       CARGO_FD_TAGGED
+ *   };
+ * @endcode
+ */
+#define CARGO_FD_TAGGED                                            \
+    typedef void CargoFDTagged;                                    \
+
+namespace cargo {
+
+namespace internals {
+
+template <typename T>
+struct isFDTaggedHelper__ {
+    template <typename C> static std::true_type
+    test(typename C::CargoFDTagged*);
+
+    template <typename C> static std::false_type
+    test(...);
+
+    static constexpr bool value = std::is_same<decltype(test<T>(0)), std::true_type>::value;
+};
+
+template <typename T>
+struct isFDTagged : public std::integral_constant<bool, isFDTaggedHelper__<T>::value> {};
+
+namespace tagged {
+
+/**
+ * The message (see MessageBuilder) holds the fields of the structure.
+ *
+ * Each field starts with a std::uint16_t tag: the position of the field << 3 | WireType.
+ * Values of the LENGTH wire type are prefixed with their size in a std::uint32_t:
+ *  - strings are the characters
+ *  - structures, unions and tuples are their tagged fields
+ *  - vectors, arrays and maps are the number of the elements followed by the elements,
+ *    the elements are written like the field values, without tags
+ *  - map elements are the key followed by the value
+ * FileDescriptor fields are the index of the passed descriptor.
+ */
+enum class WireType : std::uint16_t {
+    FIXED8 = 0,
+    FIXED16 = 1,
+    FIXED32 = 2,
+    FIXED64 = 3,
+    LENGTH = 4
+};
+
+const std::uint16_t WIRE_TYPE_BITS = 3;
+const std::size_t MAX_FIELD_COUNT = 1 << (16 - WIRE_TYPE_BITS);
+
+constexpr WireType getFixedWireType(const std::size_t size)
+{
+    return size == 1 ? WireType::FIXED8 :
+           size == 2 ? WireType::FIXED16 :
+           size == 4 ? WireType::FIXED32 : WireType::FIXED64;
+}
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+constexpr WireType getWireType(const T*)
+{
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "Type has no fixed size wire type");
+    return getFixedWireType(sizeof(T));
+}
+
+template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+constexpr WireType getWireType(const T*)
+{
+    return getFixedWireType(sizeof(typename std::underlying_type<T>::type));
+}
+
+constexpr WireType getWireType(const FileDescriptor*)
+{
+    return WireType::FIXED32;
+}
+
+template<typename T, typename std::enable_if<!std::is_arithmetic<T>::value &&
+                                             !std::is_enum<T>::value, int>::type = 0>
+constexpr WireType getWireType(const T*)
+{
+    return WireType::LENGTH;
+}
+
+template<typename T>
+constexpr WireType getWireType()
+{
+    return getWireType(static_cast<const typename std::remove_cv<T>::type*>(nullptr));
+}
+
+void putTag(MessageBuilder& output, const std::size_t index, const WireType wireType);
+
+std::uint16_t peekTag(const MessageInput& input);
+
+inline std::size_t getTagIndex(const std::uint16_t tag)
+{
+    return tag >> WIRE_TYPE_BITS;
+}
+
+inline WireType getTagWireType(const std::uint16_t tag)
+{
+    return static_cast<WireType>(tag & ((1 << WIRE_TYPE_BITS) - 1));
+}
+
+void skipValue(MessageInput& input, const WireType wireType);
+
+template<typename T, typename = void>
+struct isExtended : public std::false_type {};
+
+template<typename T>
+struct isExtended<T, typename std::conditional<true, void, typename T::ParentVisitor>::type>
+    : public std::true_type {};
+
+template<typename T, bool = isExtended<T>::value>
+struct FieldOrder {
+    static std::size_t getFieldIndex(const std::size_t position)
+    {
+        return position;
+    }
+};
+
+/**
+ * accept() visits the fields of a CARGO_EXTEND structure before the fields of its base,
+ * the positions in the tags count the fields of the base first.
+ */
+template<typename T>
+struct FieldOrder<T, true> {
+    typedef typename T::ParentVisitor Parent;
+
+    static std::size_t getFieldIndex(const std::size_t position)
+    {
+        const std::size_t parentCount = Parent::getFieldCount();
+        if (position < parentCount) {
+            return T::getFieldCount() - parentCount + FieldOrder<Parent>::getFieldIndex(position);
+        }
+        return position - parentCount;
+    }
+};
+
+template<typename Visitor>
+struct PositionVisitor {
+    Visitor* mVisitor;
+    std::size_t mPosition;
+
+    template<typename T>
+    void visit(const FieldName&, T& value)
+    {
+        mVisitor->visitPosition(mPosition, value);
+    }
+};
+
+/**
+ * Visits the fields of the structure in the order of their positions.
+ * Fields of CARGO_EXTEND structures are passed to visitor.visitPosition(position, value).
+ */
+template<typename T, typename Visitor,
+         typename std::enable_if<isExtended<typename std::remove_const<T>::type>::value, int>::type = 0>
+void accept(T& value, Visitor& visitor)
+{
+    typedef typename std::remove_const<T>::type Type;
+    for (std::size_t position = 0; position < Type::getFieldCount(); ++position) {
+        value.acceptField(FieldOrder<Type>::getFieldIndex(position), PositionVisitor<Visitor>{&visitor, position});
+    }
+}
+
+template<typename T, typename Visitor,
+         typename std::enable_if<!isExtended<typename std::remove_const<T>::type>::value, int>::type = 0>
+void accept(T& value, Visitor& visitor)
+{
+    value.accept(visitor);
+}
+
+} // namespace tagged
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FD_TAGGED_HPP
@@ -0,0 +1,124 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author Jan Olszak (j.olszak@samsung.com)
+ * @brief  Definition of a buffer collecting the data written by FDStore
+ */
+
+#include "config.hpp"
+
+#include "cargo-fd/internals/fd-write-buffer.hpp"
+
+namespace cargo {
+
+namespace internals {
+
+namespace {
+
+thread_local FDWriteBuffer* gCurrentBufferPtr = nullptr;
+
+} // namespace
+
+FDWriteBuffer::Scope::Scope(FDWriteBuffer* bufferPtr)
+    : mPreviousPtr(nullptr),
+      mIsActive(bufferPtr != nullptr)
+{
+    if (mIsActive) {
+        mPreviousPtr = exchangeCurrent(bufferPtr);
+    }
+}
+
+FDWriteBuffer::Scope::~Scope()
+{
+    if (mIsActive) {
+        exchangeCurrent(mPreviousPtr);
+    }
+}
+
+FDWriteBuffer::FDWriteBuffer(int fd)
+    : mFD(fd)
+{
+}
+
+FDWriteBuffer* FDWriteBuffer::getCurrent(int fd)
+{
+    if (gCurrentBufferPtr && gCurrentBufferPtr->mFD == fd) {
+        return gCurrentBufferPtr;
+    }
+    return nullptr;
+}
+
+FDWriteBuffer* FDWriteBuffer::exchangeCurrent(FDWriteBuffer* bufferPtr)
+{
+    FDWriteBuffer* previousPtr = gCurrentBufferPtr;
+    gCurrentBufferPtr = bufferPtr;
+    return previousPtr;
+}
+
+void FDWriteBuffer::append(const void* bufferPtr, const size_t size)
+{
+    mData.append(reinterpret_cast<const char*>(bufferPtr), size);
+}
+
+void FDWriteBuffer::flush(const unsigned int timeoutMS)
+{
+    if (mData.empty()) {
+        return;
+    }
+
+    // Write directly to the file descriptor, even if a Scope is active
+    FDWriteBuffer* currentPtr = gCurrentBufferPtr;
+    gCurrentBufferPtr = nullptr;
+    try {
+        FDStore(mFD).write(mData.data(), mData.size(), timeoutMS);
+    } catch (...) {
+        gCurrentBufferPtr = currentPtr;
+        mData.clear();
+        throw;
+    }
+    gCurrentBufferPtr = currentPtr;
+
+    // Keeps the capacity for the next batch
+    mData.clear();
+}
+
+void FDWriteBuffer::clear()
+{
+    mData.clear();
+}
+
+const char* FDWriteBuffer::data() const
+{
+    return mData.data();
+}
+
+size_t FDWriteBuffer::size() const
+{
+    return mData.size();
+}
+
+bool FDWriteBuffer::isEmpty() const
+{
+    return mData.empty();
+}
+
+} // namespace internals
+
+} // namespace cargo
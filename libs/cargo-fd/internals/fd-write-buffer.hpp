@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author Jan Olszak (j.olszak@samsung.com)
+ * @brief  Declaration of a buffer collecting the data written by FDStore
+ */
+
+#ifndef CARGO_FD_INTERNALS_FD_WRITE_BUFFER_HPP
+#define CARGO_FD_INTERNALS_FD_WRITE_BUFFER_HPP
+
+#include "cargo-fd/internals/fdstore.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Collects the data written by FDStore to one file descriptor,
+ * so that many small writes end up in one system call.
+ *
+ * The buffer is used only inside a Scope and only in the thread that created the Scope.
+ * Passing file descriptors with FDStore::sendFDs flushes the buffer first, so the order is kept.
+ */
+class FDWriteBuffer {
+public:
+    /**
+     * Makes FDStore write to the buffer for the lifetime of the Scope.
+     * Passing nullptr leaves the writes unbuffered.
+     */
+    class Scope {
+    public:
+        explicit Scope(FDWriteBuffer* bufferPtr);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        FDWriteBuffer* mPreviousPtr;
+        bool mIsActive;
+    };
+
+    /**
+     * @param fd file descriptor the buffered data is written to
+     */
+    explicit FDWriteBuffer(int fd);
+
+    FDWriteBuffer(const FDWriteBuffer&) = delete;
+    FDWriteBuffer& operator=(const FDWriteBuffer&) = delete;
+
+    /**
+     * @return buffer for the file descriptor if a Scope is active in the calling thread, nullptr otherwise
+     */
+    static FDWriteBuffer* getCurrent(int fd);
+
+    /**
+     * Makes the buffer current in the calling thread without a Scope
+     *
+     * @param bufferPtr buffer to use, nullptr leaves the writes unbuffered
+     * @return previously current buffer, to be restored by the caller
+     */
+    static FDWriteBuffer* exchangeCurrent(FDWriteBuffer* bufferPtr);
+
+    void append(const void* bufferPtr, const size_t size);
+
+    /**
+     * Writes all collected data with the fewest possible system calls
+     *
+     * @param timeoutMS timeout in milliseconds
+     */
+    void flush(const unsigned int timeoutMS = maxTimeout);
+
+    /**
+     * Drops the collected data without writing it
+     */
+    void clear();
+
+    const char* data() const;
+    size_t size() const;
+    bool isEmpty() const;
+
+private:
+    int mFD;
+    std::string mData;
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FD_WRITE_BUFFER_HPP
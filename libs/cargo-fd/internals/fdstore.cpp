@@ -25,8 +25,11 @@
 #include "config.hpp"
 
 #include "cargo-fd/internals/fdstore.hpp"
+#include "cargo-fd/internals/fd-write-buffer.hpp"
 #include "cargo/exception.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <cerrno>
 #include <unistd.h>
@@ -42,6 +45,9 @@ namespace {
 
 const int ERROR_MESSAGE_BUFFER_CAPACITY = 256;
 
+// SCM_MAX_FD of the kernel, the most file descriptors one sendmsg can pass
+const size_t MAX_FDS_PER_MESSAGE = 253;
+
 std::string getSystemErrorMessage()
 {
     char buf[ERROR_MESSAGE_BUFFER_CAPACITY];
@@ -87,31 +93,14 @@ void waitForEvent(int fd,
     }
 }
 
-} // namespace
-
-FDStore::FDStore(int fd)
-    : mFD(fd)
-{
-}
-
-FDStore::FDStore(const FDStore& store)
-    : mFD(store.mFD)
+void writeAll(int fd,
+              const void* bufferPtr,
+              const size_t size,
+              const std::chrono::high_resolution_clock::time_point deadline)
 {
-}
-
-FDStore::~FDStore()
-{
-}
-
-void FDStore::write(const void* bufferPtr, const size_t size, const unsigned int timeoutMS)
-{
-    std::chrono::high_resolution_clock::time_point deadline =
-        std::chrono::high_resolution_clock::now() +
-        std::chrono::milliseconds(timeoutMS);
-
     size_t nTotal = 0;
     for (;;) {
-        ssize_t n  = ::write(mFD,
+        ssize_t n  = ::write(fd,
                              reinterpret_cast<const char*>(bufferPtr) + nTotal,
                              size - nTotal);
         if (n < 0) {
@@ -129,19 +118,18 @@ void FDStore::write(const void* bufferPtr, const size_t size, const unsigned int
             }
         }
 
-        waitForEvent(mFD, POLLOUT, deadline);
+        waitForEvent(fd, POLLOUT, deadline);
     }
 }
 
-void FDStore::read(void* bufferPtr, const size_t size, const unsigned int timeoutMS)
+void readAll(int fd,
+             void* bufferPtr,
+             const size_t size,
+             const std::chrono::high_resolution_clock::time_point deadline)
 {
-    std::chrono::high_resolution_clock::time_point deadline =
-        std::chrono::high_resolution_clock::now() +
-        std::chrono::milliseconds(timeoutMS);
-
     size_t nTotal = 0;
     for (;;) {
-        ssize_t n  = ::read(mFD,
+        ssize_t n  = ::read(fd,
                             reinterpret_cast<char*>(bufferPtr) + nTotal,
                             size - nTotal);
         if (n < 0) {
@@ -162,136 +150,231 @@ void FDStore::read(void* bufferPtr, const size_t size, const unsigned int timeou
             }
         }
 
-        waitForEvent(mFD, POLLIN, deadline);
+        waitForEvent(fd, POLLIN, deadline);
     }
 }
 
+} // namespace
+
+FDStore::FDStore(int fd)
+    : mFD(fd)
+{
+}
+
+FDStore::FDStore(const FDStore& store)
+    : mFD(store.mFD)
+{
+}
 
-void FDStore::sendFD(int fd, const unsigned int timeoutMS)
+FDStore::~FDStore()
 {
+}
+
+void FDStore::write(const void* bufferPtr, const size_t size, const unsigned int timeoutMS)
+{
+    FDWriteBuffer* writeBufferPtr = FDWriteBuffer::getCurrent(mFD);
+    if (writeBufferPtr) {
+        writeBufferPtr->append(bufferPtr, size);
+        return;
+    }
+
     std::chrono::high_resolution_clock::time_point deadline =
         std::chrono::high_resolution_clock::now() +
         std::chrono::milliseconds(timeoutMS);
 
-    // Space for the file descriptor
+    writeAll(mFD, bufferPtr, size, deadline);
+}
+
+void FDStore::read(void* bufferPtr, const size_t size, const unsigned int timeoutMS)
+{
+    std::chrono::high_resolution_clock::time_point deadline =
+        std::chrono::high_resolution_clock::now() +
+        std::chrono::milliseconds(timeoutMS);
+
+    readAll(mFD, bufferPtr, size, deadline);
+}
+
+
+void FDStore::sendFDs(const std::vector<int>& fds,
+                      const void* bufferPtr,
+                      const size_t size,
+                      const unsigned int timeoutMS)
+{
+    // The file descriptors can't be buffered, send the preceding data first
+    FDWriteBuffer* writeBufferPtr = FDWriteBuffer::getCurrent(mFD);
+    if (writeBufferPtr) {
+        writeBufferPtr->flush(timeoutMS);
+    }
+
+    std::chrono::high_resolution_clock::time_point deadline =
+        std::chrono::high_resolution_clock::now() +
+        std::chrono::milliseconds(timeoutMS);
+
+    if (fds.empty()) {
+        writeAll(mFD, bufferPtr, size, deadline);
+        return;
+    }
+
+    // Space for the biggest chunk of file descriptors
     union {
         struct cmsghdr cmh;
-        char   control[CMSG_SPACE(sizeof(int))];
+        char   control[CMSG_SPACE(sizeof(int) * MAX_FDS_PER_MESSAGE)];
     } controlUnion;
 
-    // Ensure at least 1 byte is transmited via the socket
-    struct iovec iov;
-    char buf = '!';
-    iov.iov_base = &buf;
-    iov.iov_len = sizeof(char);
-
-    // Fill the message to send:
-    // The socket has to be connected, so we don't need to specify the name
-    struct msghdr msgh;
-    ::memset(&msgh, 0, sizeof(msgh));
-
-    // Only iovec to transmit one element
-    msgh.msg_iov = &iov;
-    msgh.msg_iovlen = 1;
-
-    // Ancillary data buffer
-    msgh.msg_control = controlUnion.control;
-    msgh.msg_controllen = sizeof(controlUnion.control);
-
-    // Describe the data that we want to send
-    struct cmsghdr *cmhp;
-    cmhp = CMSG_FIRSTHDR(&msgh);
-    cmhp->cmsg_len = CMSG_LEN(sizeof(int));
-    cmhp->cmsg_level = SOL_SOCKET;
-    cmhp->cmsg_type = SCM_RIGHTS;
-    *(reinterpret_cast<int*>(CMSG_DATA(cmhp))) = fd;
-
-    // Send
-    for(;;) {
-        ssize_t ret = ::sendmsg(mFD, &msgh, MSG_NOSIGNAL);
-        if (ret < 0) {
-            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
-                // Neglected errors, retry
+    for (size_t nSent = 0; nSent < fds.size();) {
+        const size_t nChunk = std::min(fds.size() - nSent, MAX_FDS_PER_MESSAGE);
+        const bool isLast = nSent + nChunk == fds.size();
+
+        // Each chunk starts with the number of file descriptors left, the chunk included.
+        // The data is attached to the last chunk.
+        std::uint32_t nLeft = static_cast<std::uint32_t>(fds.size() - nSent);
+        struct iovec iov[2];
+        iov[0].iov_base = &nLeft;
+        iov[0].iov_len = sizeof(nLeft);
+        iov[1].iov_base = const_cast<void*>(bufferPtr);
+        iov[1].iov_len = size;
+
+        // Fill the message to send:
+        // The socket has to be connected, so we don't need to specify the name
+        struct msghdr msgh;
+        ::memset(&msgh, 0, sizeof(msgh));
+
+        msgh.msg_iov = iov;
+        msgh.msg_iovlen = isLast && size > 0 ? 2 : 1;
+
+        // Ancillary data buffer
+        msgh.msg_control = controlUnion.control;
+        msgh.msg_controllen = CMSG_SPACE(sizeof(int) * nChunk);
+
+        // Describe the data that we want to send
+        struct cmsghdr *cmhp;
+        cmhp = CMSG_FIRSTHDR(&msgh);
+        cmhp->cmsg_len = CMSG_LEN(sizeof(int) * nChunk);
+        cmhp->cmsg_level = SOL_SOCKET;
+        cmhp->cmsg_type = SCM_RIGHTS;
+        ::memcpy(CMSG_DATA(cmhp), fds.data() + nSent, sizeof(int) * nChunk);
+
+        // Send
+        ssize_t ret;
+        for(;;) {
+            ret = ::sendmsg(mFD, &msgh, MSG_NOSIGNAL);
+            if (ret < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                    // Neglected errors, retry
+                } else {
+                    throw CargoException("Error during sendmsg: " + getSystemErrorMessage());
+                }
+            } else if (ret == 0) {
+                // Retry the sending
+            } else {
+                break;
+            }
+
+            waitForEvent(mFD, POLLOUT, deadline);
+        }
+
+        // The file descriptors went with the first byte, the rest is ordinary data
+        size_t nWritten = static_cast<size_t>(ret);
+        for (size_t i = 0; i < msgh.msg_iovlen; ++i) {
+            if (nWritten < iov[i].iov_len) {
+                writeAll(mFD,
+                         reinterpret_cast<const char*>(iov[i].iov_base) + nWritten,
+                         iov[i].iov_len - nWritten,
+                         deadline);
+                nWritten = 0;
             } else {
-                throw CargoException("Error during sendmsg: " + getSystemErrorMessage());
+                nWritten -= iov[i].iov_len;
             }
-        } else if (ret == 0) {
-            // Retry the sending
-        } else {
-            // We send only 1 byte of data. No need to repeat
-            break;
         }
 
-        waitForEvent(mFD, POLLOUT, deadline);
+        nSent += nChunk;
     }
 }
 
 
-int FDStore::receiveFD(const unsigned int timeoutMS)
+void FDStore::receiveFDs(std::vector<int>& fds, const unsigned int timeoutMS)
 {
     std::chrono::high_resolution_clock::time_point deadline =
         std::chrono::high_resolution_clock::now() +
         std::chrono::milliseconds(timeoutMS);
 
-    // Space for the file descriptor
+    // Space for the biggest chunk of file descriptors
     union {
         struct cmsghdr cmh;
-        char   control[CMSG_SPACE(sizeof(int))];
+        char   control[CMSG_SPACE(sizeof(int) * MAX_FDS_PER_MESSAGE)];
     } controlUnion;
 
-    // Describe the data that we want to recive
-    controlUnion.cmh.cmsg_len = CMSG_LEN(sizeof(int));
-    controlUnion.cmh.cmsg_level = SOL_SOCKET;
-    controlUnion.cmh.cmsg_type = SCM_RIGHTS;
-
-    // Setup the input buffer
-    // Ensure at least 1 byte is transmited via the socket
-    char buf;
-    struct iovec iov;
-    iov.iov_base = &buf;
-    iov.iov_len = sizeof(char);
-
-    // Set the ancillary data buffer
-    // The socket has to be connected, so we don't need to specify the name
-    struct msghdr msgh;
-    ::memset(&msgh, 0, sizeof(msgh));
-
-    msgh.msg_iov = &iov;
-    msgh.msg_iovlen = 1;
-
-    msgh.msg_control = controlUnion.control;
-    msgh.msg_controllen = sizeof(controlUnion.control);
-
-    // Receive
-    for(;;) {
-        ssize_t ret = ::recvmsg(mFD, &msgh, MSG_WAITALL | MSG_CMSG_CLOEXEC);
-        if (ret < 0) {
-            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
-                // Neglected errors, retry
+    std::uint32_t nExpected = 0;
+    do {
+        // Each chunk starts with the number of file descriptors left
+        std::uint32_t nLeft = 0;
+        struct iovec iov;
+        iov.iov_base = &nLeft;
+        iov.iov_len = sizeof(nLeft);
+
+        // Set the ancillary data buffer
+        // The socket has to be connected, so we don't need to specify the name
+        struct msghdr msgh;
+        ::memset(&msgh, 0, sizeof(msgh));
+
+        msgh.msg_iov = &iov;
+        msgh.msg_iovlen = 1;
+
+        msgh.msg_control = controlUnion.control;
+        msgh.msg_controllen = sizeof(controlUnion.control);
+
+        // Receive
+        ssize_t ret;
+        for(;;) {
+            ret = ::recvmsg(mFD, &msgh, MSG_WAITALL | MSG_CMSG_CLOEXEC);
+            if (ret < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                    // Neglected errors, retry
+                } else {
+                    throw CargoException("Error during recvmsg: " + getSystemErrorMessage());
+                }
+            } else if (ret == 0) {
+                throw CargoException("Peer disconnected");
             } else {
-                throw CargoException("Error during recvmsg: " + getSystemErrorMessage());
+                break;
             }
-        } else if (ret == 0) {
-            throw CargoException("Peer disconnected");
-        } else {
-            // We receive only 1 byte of data. No need to repeat
-            break;
+
+            waitForEvent(mFD, POLLIN, deadline);
         }
 
-        waitForEvent(mFD, POLLIN, deadline);
-    }
+        // Take the file descriptors before any checks, so that the caller can close them
+        size_t nReceived = 0;
+        for (struct cmsghdr *cmhp = CMSG_FIRSTHDR(&msgh); cmhp != NULL; cmhp = CMSG_NXTHDR(&msgh, cmhp)) {
+            if (cmhp->cmsg_level != SOL_SOCKET) {
+                throw CargoException("cmsg_level != SOL_SOCKET");
+            } else if (cmhp->cmsg_type != SCM_RIGHTS) {
+                throw CargoException("cmsg_type != SCM_RIGHTS");
+            }
 
-    struct cmsghdr *cmhp;
-    cmhp = CMSG_FIRSTHDR(&msgh);
-    if (cmhp == NULL || cmhp->cmsg_len != CMSG_LEN(sizeof(int))) {
-        throw CargoException("Bad cmsg length");
-    } else if (cmhp->cmsg_level != SOL_SOCKET) {
-        throw CargoException("cmsg_level != SOL_SOCKET");
-    } else if (cmhp->cmsg_type != SCM_RIGHTS) {
-        throw CargoException("cmsg_type != SCM_RIGHTS");
-    }
+            const size_t n = (cmhp->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            const int* fdsPtr = reinterpret_cast<const int*>(CMSG_DATA(cmhp));
+            fds.insert(fds.end(), fdsPtr, fdsPtr + n);
+            nReceived += n;
+        }
+
+        if (msgh.msg_flags & MSG_CTRUNC) {
+            throw CargoException("Control data truncated");
+        }
+
+        if (static_cast<size_t>(ret) < sizeof(nLeft)) {
+            readAll(mFD,
+                    reinterpret_cast<char*>(&nLeft) + ret,
+                    sizeof(nLeft) - ret,
+                    deadline);
+        }
+
+        if ((nExpected != 0 && nLeft != nExpected) ||
+            nReceived != std::min<size_t>(nLeft, MAX_FDS_PER_MESSAGE)) {
+            throw CargoException("Bad number of file descriptors");
+        }
 
-    return *(reinterpret_cast<int*>(CMSG_DATA(cmhp)));
+        nExpected = nLeft - nReceived;
+    } while (nExpected > 0);
 }
 
 } // namespace internals
@@ -26,6 +26,7 @@
 #define CARGO_FD_INTERNALS_FDSTORE_HPP
 
 #include <cstddef>
+#include <vector>
 
 namespace {
 const unsigned int maxTimeout = 5000;
@@ -67,9 +68,28 @@ public:
      */
     void read(void* bufferPtr, const size_t size, const unsigned int timeoutMS = maxTimeout);
 
-    void sendFD(int fd, const unsigned int timeoutMS = maxTimeout);
+    /**
+     * Passes file descriptors through a UNIX socket together with the data that follows them.
+     * The descriptors are sent in as few sendmsg calls as the kernel allows (SCM_MAX_FD per call).
+     * The data buffered before the call is written first.
+     *
+     * @param fds file descriptors to pass
+     * @param bufferPtr data sent right after the file descriptors
+     * @param size size of the data
+     * @param timeoutMS timeout in milliseconds
+     */
+    void sendFDs(const std::vector<int>& fds,
+                 const void* bufferPtr,
+                 const size_t size,
+                 const unsigned int timeoutMS = maxTimeout);
 
-    int receiveFD(const unsigned int timeoutMS = maxTimeout);
+    /**
+     * Receives all file descriptors passed with one sendFDs call.
+     *
+     * @param fds received file descriptors are appended here
+     * @param timeoutMS timeout in milliseconds
+     */
+    void receiveFDs(std::vector<int>& fds, const unsigned int timeoutMS = maxTimeout);
 
 private:
     int mFD;
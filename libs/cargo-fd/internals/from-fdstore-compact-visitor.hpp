@@ -0,0 +1,190 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Visitor for reading the compact format from a file descriptor
+ */
+
+#ifndef CARGO_FD_INTERNALS_FROM_FDSTORE_COMPACT_VISITOR_HPP
+#define CARGO_FD_INTERNALS_FROM_FDSTORE_COMPACT_VISITOR_HPP
+
+#include "cargo-fd/internals/fd-compact.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/types.hpp"
+#include "cargo/internals/is-visitable.hpp"
+#include "cargo/internals/is-like-tuple.hpp"
+#include "cargo/internals/visit-fields.hpp"
+
+#include <array>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Reads the fields written by ToFDStoreCompactVisitor.
+ */
+class FromFDStoreCompactVisitor {
+public:
+    static constexpr bool UNION_INDEX = true;
+
+    FromFDStoreCompactVisitor(MessageInput& input, ReceivedMessage& message)
+        : mInputPtr(&input),
+          mMessagePtr(&message)
+    {
+    }
+
+    template<typename T>
+    void visit(const FieldName&, T& value)
+    {
+        readValue(value);
+    }
+
+private:
+    MessageInput* mInputPtr;
+    ReceivedMessage* mMessagePtr;
+
+    template<typename T>
+    struct isBulk : public std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                                        !compact::isVarint<T>::value &&
+                                                        !std::is_same<T, bool>::value> {};
+
+    /**
+     * Elements of structures can take no space, others take at least one byte
+     */
+    template<typename T>
+    std::size_t readCount()
+    {
+        const std::uint64_t count = compact::getVarint(*mInputPtr);
+        if (!isVisitable<T>::value && count > mInputPtr->size()) {
+            MessageInput::throwTruncated();
+        }
+        return static_cast<std::size_t>(count);
+    }
+
+    template<typename T, typename std::enable_if<compact::isVarint<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        value = compact::fromVarint<T>(compact::getVarint(*mInputPtr));
+    }
+
+    template<typename T, typename std::enable_if<std::is_arithmetic<T>::value &&
+                                                 !compact::isVarint<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        mInputPtr->get(value);
+    }
+
+    template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        readValue(*reinterpret_cast<typename std::underlying_type<T>::type*>(&value));
+    }
+
+    void readValue(FileDescriptor& fd)
+    {
+        fd.value = mMessagePtr->takeFD(compact::fromVarint<std::uint32_t>(compact::getVarint(*mInputPtr)));
+    }
+
+    void readValue(std::string& value)
+    {
+        const std::size_t size = readCount<char>();
+        value.assign(mInputPtr->skip(size), size);
+    }
+
+    template<typename T, typename std::enable_if<isVisitable<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        value.accept(*this);
+    }
+
+    template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
+    void readValue(T& values)
+    {
+        visitFields(values, this, FieldName(""));
+    }
+
+    template<typename T, typename std::enable_if<isBulk<T>::value, int>::type = 0>
+    void readElements(T* values, const std::size_t size)
+    {
+        mInputPtr->get(values, size * sizeof(T));
+    }
+
+    template<typename T, typename std::enable_if<compact::isVarint<T>::value, int>::type = 0>
+    void readElements(T* values, const std::size_t size)
+    {
+        compact::getVarints(*mInputPtr, values, size);
+    }
+
+    template<typename T, typename std::enable_if<!isBulk<T>::value &&
+                                                 !compact::isVarint<T>::value, int>::type = 0>
+    void readElements(T* values, const std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            readValue(values[i]);
+        }
+    }
+
+    template<typename T>
+    void readValue(std::vector<T>& values)
+    {
+        values.resize(readCount<T>());
+        readElements(values.data(), values.size());
+    }
+
+    void readValue(std::vector<bool>& values)
+    {
+        values.resize(readCount<bool>());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            bool value;
+            readValue(value);
+            values[i] = value;
+        }
+    }
+
+    template<typename T, std::size_t N>
+    void readValue(std::array<T, N>& values)
+    {
+        readElements(values.data(), N);
+    }
+
+    template<typename V>
+    void readValue(std::map<std::string, V>& values)
+    {
+        const std::size_t count = readCount<std::string>();
+        for (std::size_t i = 0; i < count; ++i) {
+            std::pair<std::string, V> value;
+            readValue(value.first);
+            readValue(value.second);
+            values.insert(std::move(value));
+        }
+    }
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FROM_FDSTORE_COMPACT_VISITOR_HPP
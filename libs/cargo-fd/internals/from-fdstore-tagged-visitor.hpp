@@ -0,0 +1,217 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Visitor for reading the tagged format from a file descriptor
+ */
+
+#ifndef CARGO_FD_INTERNALS_FROM_FDSTORE_TAGGED_VISITOR_HPP
+#define CARGO_FD_INTERNALS_FROM_FDSTORE_TAGGED_VISITOR_HPP
+
+#include "cargo-fd/internals/fd-tagged.hpp"
+#include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/types.hpp"
+#include "cargo/internals/is-visitable.hpp"
+#include "cargo/internals/is-like-tuple.hpp"
+#include "cargo/internals/visit-fields.hpp"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Reads the fields written by ToFDStoreTaggedVisitor.
+ *
+ * The fields are matched by their position. Unknown fields and fields with
+ * a different wire type are skipped, missing fields are left untouched.
+ */
+class FromFDStoreTaggedVisitor {
+public:
+    static constexpr bool UNION_INDEX = true;
+
+    FromFDStoreTaggedVisitor(const MessageInput& input, ReceivedMessage& message)
+        : mInput(input),
+          mMessagePtr(&message),
+          mFieldIndex(0)
+    {
+    }
+
+    template<typename T>
+    void visit(const FieldName&, T& value)
+    {
+        visitPosition(mFieldIndex++, value);
+    }
+
+    template<typename T>
+    void visitPosition(const std::size_t index, T& value)
+    {
+        while (!mInput.empty()) {
+            const std::uint16_t tag = tagged::peekTag(mInput);
+            if (tagged::getTagIndex(tag) > index) {
+                // Field missing in the data
+                return;
+            }
+
+            mInput.skip(sizeof(tag));
+            if (tagged::getTagIndex(tag) == index &&
+                tagged::getTagWireType(tag) == tagged::getWireType<T>()) {
+                readValue(value);
+                return;
+            }
+
+            tagged::skipValue(mInput, tagged::getTagWireType(tag));
+            if (tagged::getTagIndex(tag) == index) {
+                return;
+            }
+        }
+    }
+
+private:
+    MessageInput mInput;
+    ReceivedMessage* mMessagePtr;
+    std::size_t mFieldIndex;
+
+    template<typename T>
+    struct isBulk : public std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                                        !std::is_same<T, bool>::value> {};
+
+    std::size_t readCount()
+    {
+        std::uint32_t count;
+        mInput.get(count);
+        // Every element takes at least one byte
+        if (count > mInput.size()) {
+            MessageInput::throwTruncated();
+        }
+        return count;
+    }
+
+    template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        mInput.get(value);
+    }
+
+    template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        readValue(*reinterpret_cast<typename std::underlying_type<T>::type*>(&value));
+    }
+
+    void readValue(FileDescriptor& fd)
+    {
+        std::uint32_t index;
+        mInput.get(index);
+        fd.value = mMessagePtr->takeFD(index);
+    }
+
+    void readValue(std::string& value)
+    {
+        const MessageInput nested = mInput.getNested();
+        value.assign(nested.data(), nested.size());
+    }
+
+    template<typename T, typename std::enable_if<isVisitable<T>::value, int>::type = 0>
+    void readValue(T& value)
+    {
+        FromFDStoreTaggedVisitor visitor(mInput.getNested(), *mMessagePtr);
+        tagged::accept(value, visitor);
+    }
+
+    template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
+    void readValue(T& values)
+    {
+        FromFDStoreTaggedVisitor visitor(mInput.getNested(), *mMessagePtr);
+        visitFields(values, &visitor, FieldName(""));
+    }
+
+    template<typename T, typename std::enable_if<isBulk<T>::value, int>::type = 0>
+    void readElements(T* values, const std::size_t size)
+    {
+        mInput.get(values, size * sizeof(T));
+    }
+
+    template<typename T, typename std::enable_if<!isBulk<T>::value, int>::type = 0>
+    void readElements(T* values, const std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            readValue(values[i]);
+        }
+    }
+
+    template<typename T>
+    void readValue(std::vector<T>& values)
+    {
+        FromFDStoreTaggedVisitor elements(mInput.getNested(), *mMessagePtr);
+        values.resize(elements.readCount());
+        elements.readElements(values.data(), values.size());
+    }
+
+    void readValue(std::vector<bool>& values)
+    {
+        FromFDStoreTaggedVisitor elements(mInput.getNested(), *mMessagePtr);
+        values.resize(elements.readCount());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            bool value;
+            elements.readValue(value);
+            values[i] = value;
+        }
+    }
+
+    template<typename T, std::size_t N>
+    void readValue(std::array<T, N>& values)
+    {
+        FromFDStoreTaggedVisitor elements(mInput.getNested(), *mMessagePtr);
+        const std::size_t count = elements.readCount();
+        if (count != N) {
+            throw ContainerSizeException("Expected " + std::to_string(N) +
+                                         " array elements, got " + std::to_string(count));
+        }
+        elements.readElements(values.data(), N);
+    }
+
+    template<typename V>
+    void readValue(std::map<std::string, V>& values)
+    {
+        FromFDStoreTaggedVisitor elements(mInput.getNested(), *mMessagePtr);
+        const std::size_t count = elements.readCount();
+        for (std::size_t i = 0; i < count; ++i) {
+            std::pair<std::string, V> value;
+            elements.readValue(value.first);
+            elements.readValue(value.second);
+            values.insert(std::move(value));
+        }
+    }
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_FROM_FDSTORE_TAGGED_VISITOR_HPP
@@ -26,6 +26,7 @@
 #define CARGO_FD_INTERNALS_FROM_FDSTORE_VISITOR_BASE_HPP
 
 #include "cargo-fd/internals/fdstore.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/internals/is-visitable.hpp"
 #include "cargo/internals/is-like-tuple.hpp"
 #include "cargo/internals/visit-fields.hpp"
@@ -53,7 +54,7 @@ template<typename RecursiveVisitor>
 class FromFDStoreVisitorBase {
 public:
     template<typename T>
-    void visit(const std::string&, T& value)
+    void visit(const FieldName&, T& value)
     {
         static_cast<RecursiveVisitor*>(this)->visitImpl(value);
     }
@@ -130,6 +131,19 @@ private:
         }
     }
 
+    void readInternal(std::vector<bool>& values)
+    {
+        size_t vectorSize;
+        visit(vectorSize);
+        values.resize(vectorSize);
+
+        for (std::size_t i = 0; i < vectorSize; ++i) {
+            bool value;
+            visit(value);
+            values[i] = value;
+        }
+    }
+
     template<typename T, std::size_t N>
     void readInternal(std::array<T, N>& values)
     {
@@ -154,7 +168,7 @@ private:
     template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
     void readInternal(T& values)
     {
-        visitFields(values, this, std::string());
+        visitFields(values, this, FieldName(""));
     }
 };
 
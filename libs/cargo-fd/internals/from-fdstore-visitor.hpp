@@ -26,6 +26,7 @@
 #define CARGO_FD_INTERNALS_FROM_FDSTORE_VISITOR_HPP
 
 #include "cargo-fd/internals/from-fdstore-visitor-base.hpp"
+#include "cargo-fd/internals/fd-batch.hpp"
 #include "cargo/types.hpp"
 
 namespace cargo {
@@ -34,16 +35,20 @@ namespace internals {
 
 /**
  * Default file descriptor reading visitor.
+ *
+ * All FileDescriptor fields are received with the first one, see FDSendBatch.
  */
 class FromFDStoreVisitor : public FromFDStoreVisitorBase<FromFDStoreVisitor> {
 public:
-    explicit FromFDStoreVisitor(int fd)
-        : FromFDStoreVisitorBase(fd)
+    FromFDStoreVisitor(int fd, FDReceiveBatch& fdBatch)
+        : FromFDStoreVisitorBase(fd),
+          mFDBatchPtr(&fdBatch)
     {
     }
 
     FromFDStoreVisitor(FromFDStoreVisitorBase<FromFDStoreVisitor>& visitor)
-        : FromFDStoreVisitorBase<FromFDStoreVisitor>(visitor)
+        : FromFDStoreVisitorBase<FromFDStoreVisitor>(visitor),
+          mFDBatchPtr(static_cast<FromFDStoreVisitor&>(visitor).mFDBatchPtr)
     {
     }
 
@@ -54,9 +59,11 @@ public:
     }
 
 private:
+    FDReceiveBatch* mFDBatchPtr;
+
     void readInternal(cargo::FileDescriptor& fd)
     {
-        fd = mStore.receiveFD();
+        fd = mFDBatchPtr->take();
     }
 
     template<typename T>
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Visitor for writing the compact format to a file descriptor
+ */
+
+#ifndef CARGO_FD_INTERNALS_TO_FDSTORE_COMPACT_VISITOR_HPP
+#define CARGO_FD_INTERNALS_TO_FDSTORE_COMPACT_VISITOR_HPP
+
+#include "cargo-fd/internals/fd-compact.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/types.hpp"
+#include "cargo/internals/is-visitable.hpp"
+#include "cargo/internals/is-like-tuple.hpp"
+#include "cargo/internals/visit-fields.hpp"
+
+#include <array>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Writes the fields to a MessageBuilder, integers as varints, see compact::isVarint.
+ */
+class ToFDStoreCompactVisitor {
+public:
+    static constexpr bool UNION_INDEX = true;
+
+    ToFDStoreCompactVisitor(MessageBuilder& output, std::vector<int>& fds)
+        : mOutputPtr(&output),
+          mFDsPtr(&fds)
+    {
+    }
+
+    template<typename T>
+    void visit(const FieldName&, const T& value)
+    {
+        writeValue(value);
+    }
+
+private:
+    MessageBuilder* mOutputPtr;
+    std::vector<int>* mFDsPtr;
+
+    template<typename T>
+    struct isBulk : public std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                                        !compact::isVarint<T>::value &&
+                                                        !std::is_same<T, bool>::value> {};
+
+    void writeCount(const std::size_t count)
+    {
+        compact::putVarint(*mOutputPtr, count);
+    }
+
+    template<typename T, typename std::enable_if<compact::isVarint<T>::value, int>::type = 0>
+    void writeValue(const T& value)
+    {
+        compact::putVarint(*mOutputPtr, compact::toVarint(value));
+    }
+
+    template<typename T, typename std::enable_if<std::is_arithmetic<T>::value &&
+                                                 !compact::isVarint<T>::value, int>::type = 0>
+    void writeValue(const T& value)
+    {
+        mOutputPtr->put(value);
+    }
+
+    template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    void writeValue(const T& value)
+    {
+        writeValue(static_cast<typename std::underlying_type<T>::type>(value));
+    }
+
+    void writeValue(const FileDescriptor& fd)
+    {
+        writeCount(mFDsPtr->size());
+        mFDsPtr->push_back(fd.value);
+    }
+
+    void writeValue(const std::string& value)
+    {
+        writeCount(value.size());
+        mOutputPtr->put(value.data(), value.size());
+    }
+
+    template<typename T, typename std::enable_if<isVisitable<T>::value, int>::type = 0>
+    void writeValue(const T& value)
+    {
+        value.accept(*this);
+    }
+
+    template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
+    void writeValue(const T& values)
+    {
+        visitFields(values, this, FieldName(""));
+    }
+
+    template<typename T, typename std::enable_if<isBulk<T>::value, int>::type = 0>
+    void writeElements(const T* values, const std::size_t size)
+    {
+        mOutputPtr->put(values, size * sizeof(T));
+    }
+
+    template<typename T, typename std::enable_if<!isBulk<T>::value, int>::type = 0>
+    void writeElements(const T* values, const std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            writeValue(values[i]);
+        }
+    }
+
+    template<typename T>
+    void writeValue(const std::vector<T>& values)
+    {
+        writeCount(values.size());
+        writeElements(values.data(), values.size());
+    }
+
+    void writeValue(const std::vector<bool>& values)
+    {
+        // The bits have no data(), they're written one byte per element
+        writeCount(values.size());
+        for (const bool value : values) {
+            writeValue(value);
+        }
+    }
+
+    template<typename T, std::size_t N>
+    void writeValue(const std::array<T, N>& values)
+    {
+        writeElements(values.data(), N);
+    }
+
+    template<typename V>
+    void writeValue(const std::map<std::string, V>& values)
+    {
+        writeCount(values.size());
+        for (const auto& value : values) {
+            writeValue(value.first);
+            writeValue(value.second);
+        }
+    }
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_FD_INTERNALS_TO_FDSTORE_COMPACT_VISITOR_HPP
@@ -26,6 +26,7 @@
 #define CARGO_FD_INTERNALS_TO_FDSTORE_VISITOR_BASE_HPP
 
 #include "cargo-fd/internals/fdstore.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/internals/is-visitable.hpp"
 #include "cargo/internals/is-like-tuple.hpp"
 #include "cargo/internals/visit-fields.hpp"
@@ -56,7 +57,7 @@ class ToFDStoreVisitorBase {
 
 public:
     template<typename T>
-    void visit(const std::string&, T& value)
+    void visit(const FieldName&, T& value)
     {
         static_cast<RecursiveVisitor*>(this)->visitImpl(value);
     }
@@ -145,7 +146,7 @@ private:
     template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
     void writeInternal(const T& values)
     {
-        visitFields(values, this, std::string());
+        visitFields(values, this, FieldName(""));
     }
 
 };
@@ -26,6 +26,7 @@
 #define CARGO_FD_INTERNALS_TO_FDSTORE_VISITOR_HPP
 
 #include "to-fdstore-visitor-base.hpp"
+#include "cargo-fd/internals/fd-batch.hpp"
 
 #include "cargo/types.hpp"
 
@@ -35,16 +36,20 @@ namespace internals {
 
 /**
  * Default file descriptor writing visitor.
+ *
+ * FileDescriptor fields are collected in the FDSendBatch and passed with one sendmsg.
  */
 class ToFDStoreVisitor : public ToFDStoreVisitorBase<ToFDStoreVisitor> {
 public:
-    explicit ToFDStoreVisitor(int fd)
-        : ToFDStoreVisitorBase(fd)
+    ToFDStoreVisitor(int fd, FDSendBatch& fdBatch)
+        : ToFDStoreVisitorBase(fd),
+          mFDBatchPtr(&fdBatch)
     {
     }
 
     ToFDStoreVisitor(ToFDStoreVisitorBase<ToFDStoreVisitor>& visitor)
-        : ToFDStoreVisitorBase<ToFDStoreVisitor>(visitor)
+        : ToFDStoreVisitorBase<ToFDStoreVisitor>(visitor),
+          mFDBatchPtr(static_cast<ToFDStoreVisitor&>(visitor).mFDBatchPtr)
     {
     }
 
@@ -55,9 +60,11 @@ public:
     }
 
 private:
+    FDSendBatch* mFDBatchPtr;
+
     void writeInternal(const cargo::FileDescriptor& fd)
     {
-        mStore.sendFD(fd.value);
+        mFDBatchPtr->add(fd.value);
     }
 
     template<typename T>
@@ -28,6 +28,7 @@
 #include "cargo/internals/is-visitable.hpp"
 #include "cargo/internals/is-like-tuple.hpp"
 #include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/internals/is-union.hpp"
 #include "cargo/types.hpp"
 #include "cargo/internals/visit-fields.hpp"
@@ -68,12 +69,12 @@ public:
     FromGVariantVisitor& operator=(const FromGVariantVisitor&) = delete;
 
     template<typename T>
-    void visit(const std::string& name, T& value)
+    void visit(const FieldName& name, T& value)
     {
         auto child = makeUnique(g_variant_iter_next_value(mIter));
         if (!child) {
             throw cargo::CargoException(
-                "GVariant doesn't match with Cargo. Can't set  '" + name + "'");
+                "GVariant doesn't match with Cargo. Can't set  '" + name.str() + "'");
         }
         fromGVariant(child.get(), value);
     }
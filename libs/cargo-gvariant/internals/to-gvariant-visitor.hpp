@@ -28,6 +28,7 @@
 #include "cargo/internals/is-visitable.hpp"
 #include "cargo/internals/is-union.hpp"
 #include "cargo/internals/is-like-tuple.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/types.hpp"
 #include "cargo/internals/visit-fields.hpp"
 
@@ -76,7 +77,7 @@ public:
     }
 
     template<typename T>
-    void visit(const std::string& /* name */, const T& value)
+    void visit(const FieldName& /* name */, const T& value)
     {
         writeInternal(value);
     }
@@ -169,7 +170,7 @@ private:
     void writeInternal(const T& values)
     {
         g_variant_builder_open(mBuilder, G_VARIANT_TYPE_TUPLE);
-        visitFields(values, this, std::string());
+        visitFields(values, this, FieldName(""));
         g_variant_builder_close(mBuilder);
     }
 
@@ -33,6 +33,13 @@ namespace ipc {
 
 using namespace internals;
 
+namespace {
+
+// How long start() retries while nobody listens on the socket
+const int START_TIMEOUT_MS = 1000;
+
+} // namespace
+
 Client::Client(epoll::EventPoll& eventPoll, const std::string& socketPath)
     : mEventPoll(eventPoll),
       mServiceID(),
@@ -55,13 +62,23 @@ Client::~Client()
 }
 
 void Client::start()
+{
+    startInternal(START_TIMEOUT_MS, false);
+}
+
+void Client::startWaiting(const int timeoutMS)
+{
+    startInternal(timeoutMS, true);
+}
+
+void Client::startInternal(const int timeoutMS, const bool waitForService)
 {
     if (mProcessor.isStarted()) {
         return;
     }
     LOGS("Client start");
     LOGD("Connecting to " + mSocketPath);
-    auto socketPtr = std::make_shared<Socket>(Socket::connectUNIX(mSocketPath));
+    auto socketPtr = std::make_shared<Socket>(Socket::connectUNIX(mSocketPath, timeoutMS, waitForService));
 
     mProcessor.start();
 
@@ -139,5 +156,28 @@ bool Client::isHandled(const MethodID methodID)
     return mProcessor.isHandled(methodID);
 }
 
+void Client::enableBatching(const unsigned int flushDelayUS, const size_t maxBatchSize)
+{
+    LOGS("Client enableBatching");
+    mProcessor.enableBatching(flushDelayUS, maxBatchSize);
+}
+
+void Client::disableBatching()
+{
+    LOGS("Client disableBatching");
+    mProcessor.disableBatching();
+}
+
+void Client::flush()
+{
+    mProcessor.flush();
+}
+
+void Client::enableCompression()
+{
+    LOGS("Client enableCompression");
+    mProcessor.enableCompression();
+}
+
 } // namespace ipc
 } // namespace cargo
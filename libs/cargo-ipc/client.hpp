@@ -100,6 +100,15 @@ public:
      */
     void start();
 
+    /**
+     * Starts processing, waits for the Service's socket to appear instead of failing.
+     * The Client connects as soon as the Service starts listening.
+     * @note if the Client is already running, it quits immediately (no exception thrown)
+     *
+     * @param timeoutMS         how long to wait for the Service (milliseconds)
+     */
+    void startWaiting(const int timeoutMS);
+
     /**
     * Is the communication thread running?
     *
@@ -172,6 +181,34 @@ public:
      */
     bool isHandled(const MethodID methodID);
 
+    /**
+     * Enables batching of the outgoing messages, many small messages are written in one frame.
+     *
+     * @param flushDelayUS maximal time a message waits for the frame to be written [us],
+     *                     0 writes the frame as soon as there are no more queued requests
+     * @param maxBatchSize frame size that triggers writing
+     * @see Processor::enableBatching()
+     */
+    void enableBatching(const unsigned int flushDelayUS = 0,
+                        const size_t maxBatchSize = internals::DEFAULT_MAX_BATCH_SIZE);
+
+    /**
+     * Disables batching, the already collected messages are written.
+     */
+    void disableBatching();
+
+    /**
+     * Writes the collected messages without waiting for the flush delay.
+     */
+    void flush();
+
+    /**
+     * Enables compression of the big messages to the peers that enabled it too.
+     *
+     * @see Processor::enableCompression()
+     */
+    void enableCompression();
+
     /**
      * Synchronous method call.
      *
@@ -227,6 +264,7 @@ private:
     internals::Processor mProcessor;
     std::string mSocketPath;
 
+    void startInternal(const int timeoutMS, const bool waitForService);
     void handle(const FileDescriptor fd, const epoll::Events pollEvents);
 
 };
@@ -25,6 +25,7 @@
 #include "config.hpp"
 
 #include "cargo-ipc/internals/acceptor.hpp"
+#include "utils/fd-utils.hpp"
 #include "logger/logger.hpp"
 
 #include <functional>
@@ -33,6 +34,13 @@ namespace cargo {
 namespace ipc {
 namespace internals {
 
+namespace {
+
+// Limits the connections accepted in one wakeup, so other events aren't starved
+const size_t MAX_CONNECTIONS_PER_WAKEUP = 256;
+
+} // namespace
+
 Acceptor::Acceptor(epoll::EventPoll& eventPoll,
                    const std::string& socketPath,
                    const NewConnectionCallback& newConnectionCallback)
@@ -41,6 +49,8 @@ Acceptor::Acceptor(epoll::EventPoll& eventPoll,
       mSocket(Socket::createUNIX(socketPath))
 {
     LOGT("Creating Acceptor for socket " << socketPath);
+    // Accept until there are no more pending connections
+    utils::setNonBlocking(mSocket.getFD(), true);
     mEventPoll.addFD(mSocket.getFD(), EPOLLIN, std::bind(&Acceptor::handleConnection, this));
 }
 
@@ -52,8 +62,19 @@ Acceptor::~Acceptor()
 
 void Acceptor::handleConnection()
 {
-    std::shared_ptr<Socket> tmpSocket = mSocket.accept();
-    mNewConnectionCallback(tmpSocket);
+    std::vector<std::shared_ptr<Socket>> sockets;
+    while (sockets.size() < MAX_CONNECTIONS_PER_WAKEUP) {
+        std::shared_ptr<Socket> tmpSocket = mSocket.tryAccept();
+        if (!tmpSocket) {
+            break;
+        }
+        sockets.push_back(std::move(tmpSocket));
+    }
+
+    if (!sockets.empty()) {
+        LOGT("Accepted " << sockets.size() << " connections");
+        mNewConnectionCallback(sockets);
+    }
 }
 
 } // namespace internals
@@ -30,25 +30,27 @@
 #include "cargo-ipc/types.hpp"
 
 #include <string>
+#include <vector>
 
 namespace cargo {
 namespace ipc {
 namespace internals {
 
 /**
- * Accepts new connections and passes the new socket to a callback.
+ * Accepts new connections and passes the new sockets to a callback.
+ * All the connections pending on a wakeup are accepted and passed together.
  */
 class Acceptor {
 public:
 
-    typedef std::function<void(std::shared_ptr<Socket>& socketPtr)> NewConnectionCallback;
+    typedef std::function<void(std::vector<std::shared_ptr<Socket>>& socketPtrs)> NewConnectionCallback;
 
     /**
      * Class for accepting new connections.
      *
      * @param eventPoll dispatcher
      * @param socketPath path to the socket
-     * @param newConnectionCallback called on new connections
+     * @param newConnectionCallback called with the connections accepted in one wakeup
      */
     Acceptor(epoll::EventPoll& eventPoll,
              const std::string& socketPath,
@@ -64,7 +66,7 @@ private:
     Socket mSocket;
 
     /**
-     * Handle one incoming connection.
+     * Handle the incoming connections.
      * Used with external polling
      */
     void handleConnection();
@@ -36,6 +36,7 @@
 #include <cassert>
 
 #include <sys/socket.h>
+#include <sys/ioctl.h>
 #include <limits>
 
 using namespace utils;
@@ -56,6 +57,23 @@ namespace internals {
 const MethodID Processor::RETURN_METHOD_ID = std::numeric_limits<MethodID>::max();
 const MethodID Processor::REGISTER_SIGNAL_METHOD_ID = std::numeric_limits<MethodID>::max() - 1;
 const MethodID Processor::ERROR_METHOD_ID = std::numeric_limits<MethodID>::max() - 2;
+const MethodID Processor::COMPRESSION_METHOD_ID = std::numeric_limits<MethodID>::max() - 3;
+
+namespace {
+
+// Limits the number of messages handled in one handleInput call, so other peers don't starve
+const unsigned int MAX_MESSAGES_PER_INPUT = 64;
+
+// Misbehaving peers can make these logs explode, log at most one per site per interval
+const unsigned int PEER_ERROR_LOG_INTERVAL_MS = 1000;
+
+bool hasPendingInput(const FileDescriptor fd)
+{
+    int size = 0;
+    return ::ioctl(fd, FIONREAD, &size) == 0 && size > 0;
+}
+
+} // namespace
 
 Processor::Processor(epoll::EventPoll& eventPoll,
                      const std::string& logName,
@@ -67,7 +85,13 @@ Processor::Processor(epoll::EventPoll& eventPoll,
       mIsRunning(false),
       mNewPeerCallback(newPeerCallback),
       mRemovedPeerCallback(removedPeerCallback),
-      mMaxNumberOfPeers(maxNumberOfPeers)
+      mMaxNumberOfPeers(maxNumberOfPeers),
+      mIsBatching(false),
+      mBatchFlushDelayUS(0),
+      mMaxBatchSize(DEFAULT_MAX_BATCH_SIZE),
+      mIsBatchTimerAdded(false),
+      mIsBatchTimerArmed(false),
+      mIsCompressing(false)
 {
     LOGS(mLogPrefix + "Processor Constructor");
 
@@ -158,6 +182,57 @@ void Processor::setRemovedPeerCallback(const PeerCallback& removedPeerCallback)
     mRemovedPeerCallback = removedPeerCallback;
 }
 
+void Processor::enableBatching(const unsigned int flushDelayUS, const size_t maxBatchSize)
+{
+    LOGS(mLogPrefix + "Processor enableBatching, flushDelayUS: " << flushDelayUS
+                                          << ", maxBatchSize: " << maxBatchSize);
+
+    Lock lock(mStateMutex);
+    mIsBatching = true;
+    mBatchFlushDelayUS = flushDelayUS;
+    mMaxBatchSize = maxBatchSize;
+
+    if (flushDelayUS > 0 && !mBatchTimerPtr) {
+        // Added to the poll before it's armed, by the processing thread.
+        // Adding it here could deadlock with the poll dispatching an event to handleEvent.
+        mBatchTimerPtr.reset(new utils::TimerFD());
+    }
+}
+
+void Processor::disableBatching()
+{
+    LOGS(mLogPrefix + "Processor disableBatching");
+
+    Lock lock(mStateMutex);
+    mIsBatching = false;
+    mRequestQueue.pushBack(Event::FLUSH);
+}
+
+void Processor::enableCompression()
+{
+    LOGS(mLogPrefix + "Processor enableCompression");
+
+    Lock lock(mStateMutex);
+    if (mIsCompressing) {
+        return;
+    }
+    mIsCompressing = true;
+
+    // Peers added from now on get it with the other signals
+    auto data = std::make_shared<RegisterSignalsProtocolMessage>(std::vector<MethodID> {COMPRESSION_METHOD_ID});
+    for (const PeerInfo& peerInfo : mPeerInfo) {
+        signalInternal<RegisterSignalsProtocolMessage>(REGISTER_SIGNAL_METHOD_ID,
+                                                       peerInfo.peerID,
+                                                       data);
+    }
+}
+
+void Processor::flush()
+{
+    // Doesn't take the state mutex, so it's safe to call from handlers
+    mRequestQueue.pushBack(Event::FLUSH);
+}
+
 FileDescriptor Processor::getEventFD()
 {
     Lock lock(mStateMutex);
@@ -218,6 +293,22 @@ PeerID Processor::addPeer(const std::shared_ptr<Socket>& socketPtr)
     return requestPtr->peerID;
 }
 
+void Processor::addPeers(const std::vector<std::shared_ptr<Socket>>& socketPtrs)
+{
+    LOGS(mLogPrefix + "Processor addPeers, count: " << socketPtrs.size());
+    Lock lock(mStateMutex);
+
+    std::vector<std::shared_ptr<AddPeerRequest>> requests;
+    requests.reserve(socketPtrs.size());
+    for (const auto& socketPtr : socketPtrs) {
+        requests.push_back(std::make_shared<AddPeerRequest>(socketPtr));
+        LOGI(mLogPrefix + "Add Peer Request. Id: " << shortenPeerID(requests.back()->peerID)
+                                       << ", fd: " << socketPtr->getFD());
+    }
+
+    mRequestQueue.pushBackAll(Event::ADD_PEER, requests);
+}
+
 void Processor::removePeerSyncInternal(const PeerID& peerID, Lock& lock)
 {
     LOGS(mLogPrefix + "Processor removePeer peerID: " << shortenPeerID(peerID));
@@ -300,6 +391,20 @@ void Processor::handleInput(const FileDescriptor fd)
         return;
     }
 
+    // A frame can carry many messages, handle all that already arrived
+    for (unsigned int i = 0; i < MAX_MESSAGES_PER_INPUT; ++i) {
+        handleMessage(peerIt);
+
+        // Handling could have removed the peer
+        peerIt = getPeerInfoIterator(fd);
+        if (peerIt == mPeerInfo.end() || !hasPendingInput(fd)) {
+            return;
+        }
+    }
+}
+
+void Processor::handleMessage(Peers::iterator& peerIt)
+{
     MessageHeader hdr;
     {
         try {
@@ -307,7 +412,7 @@ void Processor::handleInput(const FileDescriptor fd)
             Socket& socket = *peerIt->socketPtr;
             cargo::loadFromFD<MessageHeader>(socket.getFD(), hdr);
         } catch (const cargo::CargoException& e) {
-            LOGE(mLogPrefix + "Error during reading the socket");
+            LOGE_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS, mLogPrefix + "Error during reading the socket");
             removePeerInternal(peerIt,
                                std::make_exception_ptr(IPCNaughtyPeerException()));
             return;
@@ -327,7 +432,8 @@ void Processor::handleInput(const FileDescriptor fd)
                 onRemoteSignal(peerIt, hdr.methodID, hdr.messageID, signalCallbacks);
 
             } else {
-                LOGW(mLogPrefix + "No method or signal callback for methodID: " << hdr.methodID);
+                LOGW_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS,
+                               mLogPrefix + "No method or signal callback for methodID: " << hdr.methodID);
                 removePeerInternal(peerIt,
                                    std::make_exception_ptr(IPCNaughtyPeerException()));
             }
@@ -340,6 +446,13 @@ ipc::HandlerExitCode Processor::onNewSignals(const PeerID& peerID, std::shared_p
     LOGS(mLogPrefix + "Processor onNewSignals peerID: " << shortenPeerID(peerID));
 
     for (const MethodID methodID : data->ids) {
+        if (methodID == COMPRESSION_METHOD_ID) {
+            auto peerIt = getPeerInfoIterator(peerID);
+            if (peerIt != mPeerInfo.end()) {
+                peerIt->isCompressionAccepted = true;
+            }
+            continue;
+        }
         mSignalsPeers[methodID].push_back(peerID);
     }
 
@@ -371,7 +484,8 @@ void Processor::onReturnValue(Peers::iterator& peerIt,
         returnCallbacks = std::move(mReturnCallbacks.at(messageID));
         mReturnCallbacks.erase(messageID);
     } catch (const std::out_of_range&) {
-        LOGW(mLogPrefix + "No return callback for messageID: " << shortenMessageID(messageID));
+        LOGW_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS,
+                       mLogPrefix + "No return callback for messageID: " << shortenMessageID(messageID));
         removePeerInternal(peerIt,
                            std::make_exception_ptr(IPCNaughtyPeerException()));
         return;
@@ -407,7 +521,7 @@ void Processor::onRemoteSignal(Peers::iterator& peerIt,
         LOGT(mLogPrefix + "Parsing incoming data");
         data = signalCallbacks->parse(peerIt->socketPtr->getFD());
     } catch (const std::exception& e) {
-        LOGE(mLogPrefix + "Exception during parsing: " << e.what());
+        LOGE_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS, mLogPrefix + "Exception during parsing: " << e.what());
         removePeerInternal(peerIt,
                            std::make_exception_ptr(IPCParsingException()));
         return;
@@ -424,7 +538,7 @@ void Processor::onRemoteSignal(Peers::iterator& peerIt,
         LOGW("Discarded user's exception");
         return;
     } catch (const std::exception& e) {
-        LOGE(mLogPrefix + "Exception in method handler: " << e.what());
+        LOGE_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS, mLogPrefix + "Exception in method handler: " << e.what());
         removePeerInternal(peerIt,
                            std::make_exception_ptr(IPCNaughtyPeerException()));
         return;
@@ -444,7 +558,7 @@ void Processor::onRemoteMethod(Peers::iterator& peerIt,
         LOGT(mLogPrefix + "Parsing incoming data");
         data = methodCallbacks->parse(peerIt->socketPtr->getFD());
     } catch (const std::exception& e) {
-        LOGE(mLogPrefix + "Exception during parsing: " << e.what());
+        LOGE_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS, mLogPrefix + "Exception during parsing: " << e.what());
         removePeerInternal(peerIt,
                            std::make_exception_ptr(IPCParsingException()));
         return;
@@ -476,7 +590,7 @@ void Processor::onRemoteMethod(Peers::iterator& peerIt,
         sendError(peerIt->peerID, messageID, e.getCode(), e.what());
         return;
     } catch (const std::exception& e) {
-        LOGE(mLogPrefix + "Exception in method handler: " << e.what());
+        LOGE_RATELIMIT(PEER_ERROR_LOG_INTERVAL_MS, mLogPrefix + "Exception in method handler: " << e.what());
         removePeerInternal(peerIt,
                            std::make_exception_ptr(IPCNaughtyPeerException()));
         return;
@@ -514,6 +628,73 @@ void Processor::handleEvent()
     case Event::FINISH:
         onFinishRequest(*request.get<FinishRequest>());
         break;
+    case Event::FLUSH:
+        onFlushRequest();
+        break;
+    }
+
+    if (mIsBatching && mBatchFlushDelayUS == 0 && mRequestQueue.isEmpty()) {
+        // No more messages to batch, don't wait
+        onFlushRequest();
+    }
+}
+
+void Processor::handleBatchTimer()
+{
+    LOGS(mLogPrefix + "Processor handleBatchTimer");
+
+    Lock lock(mStateMutex);
+    mBatchTimerPtr->receive();
+    mIsBatchTimerArmed = false;
+    onFlushRequest();
+}
+
+cargo::internals::FDWriteBuffer* Processor::getWriteBuffer(PeerInfo& peerInfo)
+{
+    // Messages collected before batching was disabled have to be written first
+    if (mIsBatching || !peerInfo.writeBufferPtr->isEmpty()) {
+        return peerInfo.writeBufferPtr.get();
+    }
+    return nullptr;
+}
+
+void Processor::flushIfNeeded(PeerInfo& peerInfo)
+{
+    cargo::internals::FDWriteBuffer& writeBuffer = *peerInfo.writeBufferPtr;
+    if (writeBuffer.isEmpty()) {
+        return;
+    }
+
+    if (!mIsBatching || writeBuffer.size() >= mMaxBatchSize) {
+        LOGT(mLogPrefix + "Writing a frame of " << writeBuffer.size() << " bytes");
+        writeBuffer.flush();
+    } else if (mBatchFlushDelayUS > 0 && !mIsBatchTimerArmed) {
+        if (!mIsBatchTimerAdded) {
+            mEventPoll.addFD(mBatchTimerPtr->getFD(), EPOLLIN, std::bind(&Processor::handleBatchTimer, this));
+            mIsBatchTimerAdded = true;
+        }
+        mBatchTimerPtr->arm(std::chrono::microseconds(mBatchFlushDelayUS));
+        mIsBatchTimerArmed = true;
+    }
+}
+
+void Processor::onFlushRequest()
+{
+    LOGS(mLogPrefix + "Processor onFlushRequest");
+
+    std::vector<PeerID> failedPeers;
+    for (PeerInfo& peerInfo : mPeerInfo) {
+        try {
+            peerInfo.writeBufferPtr->flush();
+        } catch (const std::exception& e) {
+            LOGE(mLogPrefix + "Error during writing a frame: " << e.what());
+            failedPeers.push_back(peerInfo.peerID);
+        }
+    }
+
+    for (const PeerID& peerID : failedPeers) {
+        removePeerInternal(getPeerInfoIterator(peerID),
+                           std::make_exception_ptr(IPCSerializationException()));
     }
 }
 
@@ -546,11 +727,14 @@ void Processor::onMethodRequest(MethodRequest& request)
     try {
         // Send the call with the socket
         Socket& socket = *peerIt->socketPtr;
+        cargo::internals::FDWriteBuffer::Scope batchScope(getWriteBuffer(*peerIt));
+        cargo::internals::CompressionScope compressionScope(mIsCompressing && peerIt->isCompressionAccepted);
         hdr.methodID = request.methodID;
         hdr.messageID = request.messageID;
         cargo::saveToFD<MessageHeader>(socket.getFD(), hdr);
         LOGT(mLogPrefix + "Serializing the message");
         request.serialize(socket.getFD(), request.data);
+        flushIfNeeded(*peerIt);
     } catch (const std::exception& e) {
         LOGE(mLogPrefix + "Error during sending a method: " << e.what());
 
@@ -581,10 +765,13 @@ void Processor::onSignalRequest(SignalRequest& request)
     try {
         // Send the call with the socket
         Socket& socket = *peerIt->socketPtr;
+        cargo::internals::FDWriteBuffer::Scope batchScope(getWriteBuffer(*peerIt));
+        cargo::internals::CompressionScope compressionScope(mIsCompressing && peerIt->isCompressionAccepted);
         hdr.methodID = request.methodID;
         hdr.messageID = request.messageID;
         cargo::saveToFD<MessageHeader>(socket.getFD(), hdr);
         request.serialize(socket.getFD(), request.data);
+        flushIfNeeded(*peerIt);
     } catch (const std::exception& e) {
         LOGE(mLogPrefix + "Error during sending a signal: " << e.what());
 
@@ -618,6 +805,9 @@ void Processor::onAddPeerRequest(AddPeerRequest& request)
     for (const auto kv : mSignalsCallbacks) {
         ids.push_back(kv.first);
     }
+    if (mIsCompressing) {
+        ids.push_back(COMPRESSION_METHOD_ID);
+    }
     auto data = std::make_shared<RegisterSignalsProtocolMessage>(ids);
     signalInternal<RegisterSignalsProtocolMessage>(REGISTER_SIGNAL_METHOD_ID,
                                                    request.peerID,
@@ -636,7 +826,13 @@ void Processor::onRemovePeerRequest(RemovePeerRequest& request)
 {
     LOGS(mLogPrefix + "Processor onRemovePeer");
 
-    removePeerInternal(getPeerInfoIterator(request.peerID),
+    auto peerIt = getPeerInfoIterator(request.peerID);
+    if (peerIt != mPeerInfo.end()) {
+        // Best effort to deliver the batched messages
+        IGNORE_EXCEPTIONS(peerIt->writeBufferPtr->flush());
+    }
+
+    removePeerInternal(peerIt,
                        std::make_exception_ptr(IPCRemovedPeerException()));
 
     request.conditionPtr->notify_all();
@@ -666,11 +862,14 @@ void Processor::onSendResultRequest(SendResultRequest& request)
     try {
         // Send the call with the socket
         Socket& socket = *peerIt->socketPtr;
+        cargo::internals::FDWriteBuffer::Scope batchScope(getWriteBuffer(*peerIt));
+        cargo::internals::CompressionScope compressionScope(mIsCompressing && peerIt->isCompressionAccepted);
         hdr.methodID = RETURN_METHOD_ID;
         hdr.messageID = request.messageID;
         cargo::saveToFD<MessageHeader>(socket.getFD(), hdr);
         LOGT(mLogPrefix + "Serializing the message");
         methodCallbacks->serialize(socket.getFD(), request.data);
+        flushIfNeeded(*peerIt);
     } catch (const std::exception& e) {
         LOGE(mLogPrefix + "Error during sending a method: " << e.what());
 
@@ -721,10 +920,14 @@ void Processor::onFinishRequest(FinishRequest& requestFinisher)
         case Event::SIGNAL:
         case Event::ADD_PEER:
         case Event::REMOVE_METHOD:
+        case Event::FLUSH:
             break;
         }
     }
 
+    // Write the batched messages
+    onFlushRequest();
+
     // Close peers
     while (!mPeerInfo.empty()) {
         removePeerInternal(--mPeerInfo.end(),
@@ -732,6 +935,12 @@ void Processor::onFinishRequest(FinishRequest& requestFinisher)
     }
 
     mEventPoll.removeFD(mRequestQueue.getFD());
+    if (mIsBatchTimerAdded) {
+        mEventPoll.removeFD(mBatchTimerPtr->getFD());
+        mBatchTimerPtr->disarm();
+        mIsBatchTimerAdded = false;
+        mIsBatchTimerArmed = false;
+    }
     mIsRunning = false;
     requestFinisher.conditionPtr->notify_all();
     for(auto & c : remainingFinishRequests) {
@@ -777,6 +986,11 @@ std::ostream& operator<<(std::ostream& os, const Processor::Event& event)
         os << "Event::SEND_RESULT";
         break;
     }
+
+    case Processor::Event::FLUSH: {
+        os << "Event::FLUSH";
+        break;
+    }
     }
 
     return os;
@@ -40,9 +40,11 @@
 #include "cargo-ipc/method-result.hpp"
 #include "cargo-ipc/types.hpp"
 #include "cargo-fd/cargo-fd.hpp"
+#include "cargo-fd/internals/fd-write-buffer.hpp"
 #include "cargo/fields.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger-scope.hpp"
+#include "utils/timerfd.hpp"
 
 #include <ostream>
 #include <condition_variable>
@@ -52,6 +54,7 @@
 #include <thread>
 #include <string>
 #include <list>
+#include <memory>
 #include <functional>
 #include <unordered_map>
 #include <utility>
@@ -61,6 +64,7 @@ namespace ipc {
 namespace internals {
 
 const unsigned int DEFAULT_MAX_NUMBER_OF_PEERS = 500;
+const size_t DEFAULT_MAX_BATCH_SIZE = 64 * 1024;
 /**
 * This class wraps communication via UX sockets
 *
@@ -74,6 +78,12 @@ const unsigned int DEFAULT_MAX_NUMBER_OF_PEERS = 500;
 * - MessageID - unique id of a message exchange sent by this object instance. Used to identify reply messages.
 * - Rest: The data written in a callback. One type per method.ReturnCallbacks
 *
+* With batching enabled consecutive messages to one peer are written in one frame.
+* A frame is just a concatenation of messages, so the receiver doesn't have to enable batching.
+*
+* Compression is used between two Processors that enabled it. Each announces it to the peer
+* as a registered signal with COMPRESSION_METHOD_ID, which older peers just store.
+*
 * TODO: API for removing signals
 * TODO: Implement HandlerStore class for storing/handling handlers. This will simplify Processor.
 * TODO: Implement CallbackStore class for storing/handling ReturnCallbacks. This will simplify Processor.
@@ -89,7 +99,8 @@ private:
         ADD_PEER,    // New peer in the queue
         REMOVE_PEER, // Remove peer
         SEND_RESULT,  // Send the result of a method's call
-        REMOVE_METHOD  // Remove method handler
+        REMOVE_METHOD,  // Remove method handler
+        FLUSH        // Write all batched messages
     };
 
 public:
@@ -110,6 +121,11 @@ public:
     */
     static const MethodID ERROR_METHOD_ID;
 
+    /**
+     * Registered as a signal by the peers accepting compressed messages
+     */
+    static const MethodID COMPRESSION_METHOD_ID;
+
     /**
      * Constructs the Processor, but doesn't start it.
      * The object is ready to add methods.
@@ -173,6 +189,47 @@ public:
      */
     PeerID addPeer(const std::shared_ptr<Socket>& socketPtr);
 
+    /**
+     * Adds many peers at once, e.g. all connections accepted in one wakeup.
+     * From now on sockets are owned by the Processor object.
+     *
+     * @param socketPtrs pointers to the new sockets
+     */
+    void addPeers(const std::vector<std::shared_ptr<Socket>>& socketPtrs);
+
+    /**
+     * Enables batching of the outgoing messages.
+     * Messages to one peer are collected and written in one frame when:
+     * - the frame reaches maxBatchSize bytes,
+     * - flushDelayUS passes since the first message of the frame was collected,
+     * - flush() is called.
+     * With flushDelayUS equal 0 the frames are written as soon as there are no more queued requests,
+     * so bursts of messages are batched without delaying a lone message.
+     *
+     * @param flushDelayUS maximal time a message waits for the frame to be written [us]
+     * @param maxBatchSize frame size that triggers writing
+     */
+    void enableBatching(const unsigned int flushDelayUS = 0,
+                        const size_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE);
+
+    /**
+     * Disables batching, already collected messages are written
+     */
+    void disableBatching();
+
+    /**
+     * Enables compression of the messages to the peers that enabled it too.
+     * Only data written as one message is compressed, i.e. structures with CARGO_FD_TAGGED,
+     * see cargo::FDCompression.
+     */
+    void enableCompression();
+
+    /**
+     * Writes all messages queued so far, without waiting for the batching deadline.
+     * Doesn't block, the frames are written in the processing thread.
+     */
+    void flush();
+
     /**
      * Saves the callbacks connected to the method id.
      * When a message with the given method id is received,
@@ -443,10 +500,15 @@ private:
         PeerInfo& operator=(PeerInfo &&) = default;
 
         PeerInfo(PeerID peerID, const std::shared_ptr<Socket>& socketPtr)
-            : peerID(peerID), socketPtr(socketPtr) {}
+            : peerID(peerID),
+              socketPtr(socketPtr),
+              writeBufferPtr(new cargo::internals::FDWriteBuffer(socketPtr->getFD())),
+              isCompressionAccepted(false) {}
 
         PeerID peerID;
         std::shared_ptr<Socket> socketPtr;
+        std::unique_ptr<cargo::internals::FDWriteBuffer> writeBufferPtr;
+        bool isCompressionAccepted;
     };
 
     epoll::EventPoll& mEventPoll;
@@ -475,6 +537,16 @@ private:
 
     unsigned int mMaxNumberOfPeers;
 
+    // Batching of the outgoing messages
+    bool mIsBatching;
+    unsigned int mBatchFlushDelayUS;
+    size_t mMaxBatchSize;
+    std::unique_ptr<utils::TimerFD> mBatchTimerPtr;
+    bool mIsBatchTimerAdded;
+    bool mIsBatchTimerArmed;
+
+    bool mIsCompressing;
+
     template<typename SentDataType, typename ReceivedDataType>
     void setMethodHandlerInternal(const MethodID methodID,
                                   const typename MethodHandler<SentDataType, ReceivedDataType>::type& process);
@@ -496,6 +568,12 @@ private:
     void onSendResultRequest(SendResultRequest& request);
     void onRemoveMethodRequest(RemoveMethodRequest& request);
     void onFinishRequest(FinishRequest& request);
+    void onFlushRequest();
+
+    void handleMessage(Peers::iterator& peerIt);
+    void handleBatchTimer();
+    cargo::internals::FDWriteBuffer* getWriteBuffer(PeerInfo& peerInfo);
+    void flushIfNeeded(PeerInfo& peerInfo);
 
     void onReturnValue(Peers::iterator& peerIt,
                        const MessageID& messageID);
@@ -551,7 +629,9 @@ template<typename SentDataType, typename ReceivedDataType>
 void Processor::setMethodHandler(const MethodID methodID,
                                  const typename MethodHandler<SentDataType, ReceivedDataType>::type& method)
 {
-    if (methodID == RETURN_METHOD_ID || methodID == REGISTER_SIGNAL_METHOD_ID) {
+    if (methodID == RETURN_METHOD_ID ||
+        methodID == REGISTER_SIGNAL_METHOD_ID ||
+        methodID == COMPRESSION_METHOD_ID) {
         LOGE(mLogPrefix + "Forbidden methodID: " << methodID);
         throw IPCException("Forbidden methodID: " + std::to_string(methodID));
     }
@@ -593,7 +673,9 @@ template<typename ReceivedDataType>
 void Processor::setSignalHandler(const MethodID methodID,
                                  const typename SignalHandler<ReceivedDataType>::type& handler)
 {
-    if (methodID == RETURN_METHOD_ID || methodID == REGISTER_SIGNAL_METHOD_ID) {
+    if (methodID == RETURN_METHOD_ID ||
+        methodID == REGISTER_SIGNAL_METHOD_ID ||
+        methodID == COMPRESSION_METHOD_ID) {
         LOGE(mLogPrefix + "Forbidden methodID: " << methodID);
         throw IPCException("Forbidden methodID: " + std::to_string(methodID));
     }
@@ -33,6 +33,7 @@
 #include <memory>
 #include <mutex>
 #include <algorithm>
+#include <vector>
 
 namespace cargo {
 namespace ipc {
@@ -88,6 +89,16 @@ public:
     void pushBack(const RequestIdType requestID,
                   const std::shared_ptr<void>& data = nullptr);
 
+    /**
+     * Push many requests of the same type to back of the queue at once
+     *
+     * @param requestID request type
+     * @param dataVector data corresponding to the consecutive requests
+     */
+    template<typename DataType>
+    void pushBackAll(const RequestIdType requestID,
+                     const std::vector<std::shared_ptr<DataType>>& dataVector);
+
     /**
      * Push data to back of the queue
      *
@@ -143,6 +154,23 @@ void RequestQueue<RequestIdType>::pushBack(const RequestIdType requestID,
     mEventFD.send();
 }
 
+template<typename RequestIdType>
+template<typename DataType>
+void RequestQueue<RequestIdType>::pushBackAll(const RequestIdType requestID,
+                                              const std::vector<std::shared_ptr<DataType>>& dataVector)
+{
+    if (dataVector.empty()) {
+        return;
+    }
+
+    Lock lock(mStateMutex);
+    for (const auto& data : dataVector) {
+        Request request(requestID, data);
+        mRequests.push_back(std::move(request));
+    }
+    mEventFD.send(dataVector.size());
+}
+
 template<typename RequestIdType>
 void RequestQueue<RequestIdType>::pushFront(const RequestIdType requestID,
                                             const std::shared_ptr<void>& data)
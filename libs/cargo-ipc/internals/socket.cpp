@@ -26,8 +26,11 @@
 
 #include "cargo-ipc/exception.hpp"
 #include "cargo-ipc/internals/socket.hpp"
+#include "cargo-ipc/epoll/event-poll.hpp"
 #include "utils/fd-utils.hpp"
 #include "utils/exception.hpp"
+#include "utils/inotify.hpp"
+#include "utils/paths.hpp"
 #include "logger/logger.hpp"
 
 #ifdef HAVE_SYSTEMD
@@ -37,9 +40,13 @@
 #include <sys/stat.h>
 #include <sys/un.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <memory>
+#include <random>
 #include <thread>
 
 using namespace utils;
@@ -50,7 +57,8 @@ namespace internals {
 
 namespace {
 const int MAX_QUEUE_LENGTH = 1000;
-const int RETRY_CONNECT_STEP_MS = 100;
+const int MIN_RETRY_CONNECT_STEP_US = 500;
+const int MAX_RETRY_CONNECT_STEP_US = 100000;
 const int UNIX_SOCKET_PROTOCOL = 0;
 
 void setFdOptions(const int fd)
@@ -81,38 +89,177 @@ std::unique_ptr<::addrinfo, void(*)(::addrinfo*)> getAddressInfo(const std::stri
     return std::unique_ptr<::addrinfo, void(*)(::addrinfo*)>(addressInfo, ::freeaddrinfo);
 }
 
+/**
+ * Waits between the connect retries.
+ * The step grows exponentially with a random jitter, so many clients don't retry in lockstep.
+ * If the socket's path is watched, the wait ends as soon as the path is created.
+ */
+class ConnectRetry {
+public:
+    ConnectRetry(const std::chrono::steady_clock::time_point& deadline)
+        : mDeadline(deadline),
+          mStepUS(MIN_RETRY_CONNECT_STEP_US),
+          mIsPathCreated(false)
+    {
+    }
+
+    /**
+     * Watches the directory of the socket, waits will end when the socket file is created.
+     * Falls back to the plain backoff if the directory can't be watched.
+     */
+    void watchPath(const std::string& path)
+    {
+        if (mInotifyPtr) {
+            return;
+        }
+
+        try {
+            // Only the connects that wait for the path need the poll
+            if (!mEventPollPtr) {
+                mEventPollPtr.reset(new cargo::ipc::epoll::EventPoll());
+            }
+            std::unique_ptr<utils::Inotify> inotifyPtr(new utils::Inotify(*mEventPollPtr));
+            const std::string fileName = path.substr(path.rfind('/') + 1);
+            inotifyPtr->setHandler(utils::dirName(path),
+                                   IN_CREATE | IN_MOVED_TO,
+                                   [this, fileName](const std::string& name, const uint32_t) {
+                if (name == fileName) {
+                    mIsPathCreated = true;
+                }
+            });
+            mInotifyPtr = std::move(inotifyPtr);
+        } catch (const utils::UtilsException& e) {
+            LOGW("Can't watch the socket's path, falling back to polling: " << e.what());
+        }
+    }
+
+    /**
+     * @return false if the deadline passed
+     */
+    bool wait()
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= mDeadline) {
+            return false;
+        }
+
+        std::uniform_int_distribution<int> jitter(mStepUS / 2, mStepUS);
+        auto step = std::min<std::chrono::steady_clock::duration>(std::chrono::microseconds(jitter(getGenerator())),
+                                                                   mDeadline - now);
+        mStepUS = std::min(mStepUS * 2, MAX_RETRY_CONNECT_STEP_US);
+
+        if (!mInotifyPtr) {
+            std::this_thread::sleep_for(step);
+            return true;
+        }
+
+        mIsPathCreated = false;
+        auto stepEnd = now + step;
+        do {
+            auto timeoutMS = std::chrono::duration_cast<std::chrono::milliseconds>(stepEnd - std::chrono::steady_clock::now());
+            mEventPollPtr->dispatchIteration(std::max(0, static_cast<int>(timeoutMS.count())));
+        } while (!mIsPathCreated && std::chrono::steady_clock::now() < stepEnd);
+
+        if (mIsPathCreated) {
+            // The Service is just starting, it will listen in a moment
+            mStepUS = MIN_RETRY_CONNECT_STEP_US;
+        }
+        return true;
+    }
+
+private:
+    std::chrono::steady_clock::time_point mDeadline;
+    int mStepUS;
+    bool mIsPathCreated;
+    std::unique_ptr<cargo::ipc::epoll::EventPoll> mEventPollPtr;
+    std::unique_ptr<utils::Inotify> mInotifyPtr;
+
+    static std::minstd_rand& getGenerator()
+    {
+        static thread_local std::minstd_rand generator(std::random_device{}());
+        return generator;
+    }
+};
+
+/**
+ * Waits for the non-blocking connect to finish
+ *
+ * @return 0 or the error of the connect
+ */
+int waitForConnect(const int socket, const std::chrono::steady_clock::time_point& deadline)
+{
+    ::pollfd fds[1];
+    fds[0].fd = socket;
+    fds[0].events = POLLOUT;
+
+    for (;;) {
+        auto timeoutMS = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        int ret = ::poll(fds, 1, std::max(0, static_cast<int>(timeoutMS.count())));
+        if (ret == -1 && errno == EINTR) {
+            continue;
+        }
+        if (ret == -1) {
+            return errno;
+        }
+        if (ret == 0) {
+            return ETIMEDOUT;
+        }
+        break;
+    }
+
+    int error = 0;
+    ::socklen_t length = sizeof(error);
+    if (-1 == ::getsockopt(socket, SOL_SOCKET, SO_ERROR, &error, &length)) {
+        return errno;
+    }
+    return error;
+}
+
 void connect(const int socket,
              const ::sockaddr* address,
              const ::socklen_t addressLength,
-             const unsigned int timeoutMS)
+             const unsigned int timeoutMS,
+             const bool waitForPath)
 {
     auto deadline = std::chrono::steady_clock::now() +
                     std::chrono::milliseconds(timeoutMS);
 
+    ConnectRetry retry(deadline);
+    if (waitForPath && address->sa_family == AF_UNIX) {
+        retry.watchPath(reinterpret_cast<const ::sockaddr_un*>(address)->sun_path);
+    }
+
     // There's a race between connect() in one peer and listen() in the other.
     // We'll retry connect if no one is listening.
     do {
-        if (-1 != ::connect(socket,
-                            address,
-                            addressLength)) {
+        int error = 0;
+        if (-1 == ::connect(socket, address, addressLength)) {
+            error = errno;
+            if (error == EINPROGRESS) {
+                error = waitForConnect(socket, deadline);
+            }
+        }
+
+        if (error == 0) {
             return;
         }
 
-        if (errno == ECONNREFUSED || errno == EAGAIN || errno == EINTR) {
-            // No one is listening, so sleep and retry
-            LOGW("No one listening on the socket, retrying");
-            std::this_thread::sleep_for(std::chrono::milliseconds(RETRY_CONNECT_STEP_MS));
+        if (error == ECONNREFUSED || error == EAGAIN || error == EINTR ||
+            (waitForPath && error == ENOENT)) {
+            // No one is listening, so wait and retry
+            LOGD("No one listening on the socket, retrying");
             continue;
         }
 
         // Error
         utils::close(socket);
-        const std::string msg = "Error in connect: " + getSystemErrorMessage();
+        const std::string msg = "Error in connect: " + getSystemErrorMessage(error);
         LOGE(msg);
         throw IPCException(msg);
 
-    } while (std::chrono::steady_clock::now() < deadline);
+    } while (retry.wait());
 
+    utils::close(socket);
     const std::string msg = "Timeout in connect";
     LOGE(msg);
     throw IPCException(msg);
@@ -136,20 +283,13 @@ int getConnectedFd(const int family,
                    const int protocol,
                    const ::sockaddr* address,
                    const ::socklen_t addressLength,
-                   const int timeoutMs)
+                   const int timeoutMs,
+                   const bool waitForPath = false)
 {
-    int fd = getSocketFd(family, type, protocol);
+    // Nonblocking socket, the connect doesn't block either
+    int fd = getSocketFd(family, type | SOCK_NONBLOCK, protocol);
 
-    connect(fd, address, addressLength, timeoutMs);
-
-    // Nonblocking socket
-    int flags = ::fcntl(fd, F_GETFL, 0);
-    if (-1 == ::fcntl(fd, F_SETFL, flags | O_NONBLOCK)) {
-        utils::close(fd);
-        const std::string msg = "Error in fcntl: " + getSystemErrorMessage();
-        LOGE(msg);
-        throw IPCException(msg);
-    }
+    connect(fd, address, addressLength, timeoutMs, waitForPath);
 
     return fd;
 }
@@ -212,16 +352,34 @@ int Socket::getFD() const
 
 std::shared_ptr<Socket> Socket::accept()
 {
-    int sockfd = ::accept(mFD, nullptr, nullptr);
+    int sockfd = ::accept4(mFD, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
     if (sockfd == -1) {
         const std::string msg = "Error in accept: " + getSystemErrorMessage();
         LOGE(msg);
         throw IPCException(msg);
     }
-    setFdOptions(sockfd);
     return std::make_shared<Socket>(sockfd);
 }
 
+std::shared_ptr<Socket> Socket::tryAccept()
+{
+    for (;;) {
+        int sockfd = ::accept4(mFD, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (sockfd != -1) {
+            return std::make_shared<Socket>(sockfd);
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return nullptr;
+        }
+        if (errno != EINTR && errno != ECONNABORTED) {
+            const std::string msg = "Error in accept: " + getSystemErrorMessage();
+            LOGE(msg);
+            throw IPCException(msg);
+        }
+    }
+}
+
 Socket::Type Socket::getType() const
 {
     int family;
@@ -350,7 +508,7 @@ Socket Socket::createINET(const std::string& host, const std::string& service)
     return Socket(fd);
 }
 
-Socket Socket::connectUNIX(const std::string& path, const int timeoutMs)
+Socket Socket::connectUNIX(const std::string& path, const int timeoutMs, const bool waitForPath)
 {
     // Isn't the path too long?
     if (path.size() >= sizeof(::sockaddr_un::sun_path)) {
@@ -369,7 +527,8 @@ Socket Socket::connectUNIX(const std::string& path, const int timeoutMs)
                             UNIX_SOCKET_PROTOCOL,
                             reinterpret_cast<struct sockaddr*>(&serverAddress),
                             sizeof(struct ::sockaddr_un),
-                            timeoutMs);
+                            timeoutMs,
+                            waitForPath);
 
     return Socket(fd);
 }
@@ -86,10 +86,20 @@ public:
 
     /**
      * Accepts connection. Used by a server application.
-     * Blocking, called by a server.
+     * Waits for a connection only if the listening socket is blocking,
+     * otherwise throws when there is no pending connection (see tryAccept).
+     * The accepted socket is non-blocking and closed on exec.
      */
     std::shared_ptr<Socket> accept();
 
+    /**
+     * Accepts a pending connection, if there is any.
+     * Used with a non-blocking listening socket.
+     *
+     * @return accepted socket or nullptr if there was no pending connection
+     */
+    std::shared_ptr<Socket> tryAccept();
+
     /**
      * Returns the socket type based on it's domain.
      */
@@ -121,11 +131,17 @@ public:
 
     /**
      * Connects to an UNIX socket. Called as a client.
+     * Retries with a growing, randomized step while no one listens on the socket.
      *
      * @param path path to the socket
+     * @param timeoutMs how long to retry
+     * @param waitForPath retry also if the socket doesn't exist yet,
+     *                    wakes up as soon as the socket file is created
      * @return connected socket
      */
-    static Socket connectUNIX(const std::string& path, const int timeoutMs = 1000);
+    static Socket connectUNIX(const std::string& path,
+                              const int timeoutMs = 1000,
+                              const bool waitForPath = false);
 
     /**
      * Connects to an INET socket. Called as a client.
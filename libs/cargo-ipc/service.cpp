@@ -40,7 +40,7 @@ Service::Service(epoll::EventPoll& eventPoll,
                  const PeerCallback& removePeerCallback)
     : mEventPoll(eventPoll),
       mProcessor(eventPoll, "[SERVICE] "),
-      mAcceptor(eventPoll, socketPath, std::bind(&Processor::addPeer, &mProcessor, _1))
+      mAcceptor(eventPoll, socketPath, std::bind(&Processor::addPeers, &mProcessor, _1))
 
 {
     LOGS("Service Constructor");
@@ -143,5 +143,28 @@ bool Service::isHandled(const MethodID methodID)
     return mProcessor.isHandled(methodID);
 }
 
+void Service::enableBatching(const unsigned int flushDelayUS, const size_t maxBatchSize)
+{
+    LOGS("Service enableBatching");
+    mProcessor.enableBatching(flushDelayUS, maxBatchSize);
+}
+
+void Service::disableBatching()
+{
+    LOGS("Service disableBatching");
+    mProcessor.disableBatching();
+}
+
+void Service::flush()
+{
+    mProcessor.flush();
+}
+
+void Service::enableCompression()
+{
+    LOGS("Service enableCompression");
+    mProcessor.enableCompression();
+}
+
 } // namespace ipc
 } // namespace cargo
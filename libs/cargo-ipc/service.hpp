@@ -185,6 +185,34 @@ public:
      */
     bool isHandled(const MethodID methodID);
 
+    /**
+     * Enables batching of the outgoing messages, many small messages are written in one frame.
+     *
+     * @param flushDelayUS maximal time a message waits for the frame to be written [us],
+     *                     0 writes the frame as soon as there are no more queued requests
+     * @param maxBatchSize frame size that triggers writing
+     * @see Processor::enableBatching()
+     */
+    void enableBatching(const unsigned int flushDelayUS = 0,
+                        const size_t maxBatchSize = internals::DEFAULT_MAX_BATCH_SIZE);
+
+    /**
+     * Disables batching, the already collected messages are written.
+     */
+    void disableBatching();
+
+    /**
+     * Writes the collected messages without waiting for the flush delay.
+     */
+    void flush();
+
+    /**
+     * Enables compression of the big messages to the peers that enabled it too.
+     *
+     * @see Processor::enableCompression()
+     */
+    void enableCompression();
+
     /**
      * Synchronous method call.
      *
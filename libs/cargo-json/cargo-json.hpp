@@ -27,26 +27,101 @@
 #define CARGO_JSON_CARGO_JSON_HPP
 
 #include "utils/fs.hpp"
-#include "cargo-json/internals/to-json-visitor.hpp"
+#include "utils/mapped-file.hpp"
+#include "cargo-json/internals/to-json-stream-visitor.hpp"
 #include "cargo-json/internals/from-json-visitor.hpp"
+#include "cargo-json/internals/from-json-stream-visitor.hpp"
+
+#include <string>
+#include <vector>
 
 namespace cargo {
 
 /*@{*/
 
+/**
+ * Parsers of the loaded json
+ */
+enum class JsonParser {
+    JSON_C,     ///< json-c document tree, the whole text is parsed before filling the visitable
+    STREAMING   ///< the visitable is filled while reading the text, nothing else is allocated
+};
+
+/**
+ * Fills the visitable with data stored in the buffer
+ *
+ * @param data          data in a json format, doesn't have to be null terminated
+ * @param size          size of the data
+ * @param visitable     visitable structure to fill
+ * @param parser        parser of the json text
+ */
+template <class Cargo>
+void loadFromJsonBuffer(const char* data,
+                        const std::size_t size,
+                        Cargo& visitable,
+                        const JsonParser parser = JsonParser::JSON_C)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    if (parser == JsonParser::STREAMING) {
+        internals::FromJsonStreamVisitor::load(data, data + size, visitable);
+        return;
+    }
+
+    internals::FromJsonVisitor visitor(data, size);
+    visitable.accept(visitor);
+}
+
 /**
  * Fills the visitable with data stored in the json string
  *
  * @param jsonString    data in a json format
- * @param visitable        visitable structure to fill
+ * @param visitable     visitable structure to fill
+ * @param parser        parser of the json text
  */
 template <class Cargo>
-void loadFromJsonString(const std::string& jsonString, Cargo& visitable)
+void loadFromJsonString(const std::string& jsonString,
+                        Cargo& visitable,
+                        const JsonParser parser = JsonParser::JSON_C)
+{
+    loadFromJsonBuffer(jsonString.data(), jsonString.size(), visitable, parser);
+}
+
+/**
+ * Fills only the selected fields of the visitable with data stored in the json string,
+ * the other fields are left untouched. The text of the other fields is skipped without parsing.
+ *
+ * @param jsonString    data in a json format
+ * @param visitable     visitable structure to fill
+ * @param paths         paths of the fields, names separated by dots, e.g. {"network.mtu", "limits"}
+ */
+template <class Cargo>
+void loadFieldsFromJsonString(const std::string& jsonString,
+                              Cargo& visitable,
+                              const std::vector<std::string>& paths)
 {
     static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
 
-    internals::FromJsonVisitor visitor(jsonString);
-    visitable.accept(visitor);
+    internals::FromJsonStreamVisitor::loadFields(jsonString.data(),
+                                                 jsonString.data() + jsonString.size(),
+                                                 visitable,
+                                                 paths);
+}
+
+/**
+ * Writes the visitable in json format into the string, replacing its content.
+ * The string's memory is reused, so a string kept between the calls is allocated only when it grows.
+ *
+ * @param visitable   visitable structure to convert
+ * @param jsonString  output string
+ */
+template <class Cargo>
+void saveToJsonString(const Cargo& visitable, std::string& jsonString)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    jsonString.clear();
+    internals::ToJsonStreamVisitor::writeObject(jsonString, visitable);
 }
 
 /**
@@ -57,25 +132,52 @@ void loadFromJsonString(const std::string& jsonString, Cargo& visitable)
 template <class Cargo>
 std::string saveToJsonString(const Cargo& visitable)
 {
-    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+    std::string jsonString;
+    jsonString.reserve(1024);
+    saveToJsonString(visitable, jsonString);
+    return jsonString;
+}
 
-    internals::ToJsonVisitor visitor;
-    visitable.accept(visitor);
-    return visitor.toString();
+/**
+ * Loads the visitable from a json file.
+ * The file is mapped into memory and parsed without copying it.
+ *
+ * @param filename    path to the file
+ * @param visitable   visitable structure to load
+ * @param parser      parser of the json text
+ */
+template <class Cargo>
+void loadFromJsonFile(const std::string& filename,
+                      Cargo& visitable,
+                      const JsonParser parser = JsonParser::JSON_C)
+{
+    const utils::MappedFile file(filename);
+    try {
+        loadFromJsonBuffer(file.data(), file.size(), visitable, parser);
+    } catch (CargoException& e) {
+        const std::string& msg = "Error in " + filename + ": " + e.what();
+        throw CargoException(msg);
+    }
 }
 
 /**
- * Loads the visitable from a json file
+ * Loads only the selected fields of the visitable from a json file,
+ * the other fields are left untouched.
  *
  * @param filename    path to the file
  * @param visitable   visitable structure to load
+ * @param paths       paths of the fields, names separated by dots, e.g. {"network.mtu", "limits"}
  */
 template <class Cargo>
-void loadFromJsonFile(const std::string& filename, Cargo& visitable)
+void loadFieldsFromJsonFile(const std::string& filename,
+                            Cargo& visitable,
+                            const std::vector<std::string>& paths)
 {
-    const std::string content = utils::readFileContent(filename);
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    const utils::MappedFile file(filename);
     try {
-        loadFromJsonString(content, visitable);
+        internals::FromJsonStreamVisitor::loadFields(file.data(), file.data() + file.size(), visitable, paths);
     } catch (CargoException& e) {
         const std::string& msg = "Error in " + filename + ": " + e.what();
         throw CargoException(msg);
@@ -92,7 +194,7 @@ template <class Cargo>
 void saveToJsonFile(const std::string& filename, const Cargo& visitable)
 {
     const std::string content = saveToJsonString(visitable);
-    utils::saveFileContent(filename, content);
+    utils::saveFileContentAtomic(filename, content);
 }
 
 } // namespace cargo
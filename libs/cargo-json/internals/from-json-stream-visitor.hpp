@@ -0,0 +1,491 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   JSON visitor filling the structure while parsing the text
+ */
+
+#ifndef CARGO_JSON_INTERNALS_FROM_JSON_STREAM_VISITOR_HPP
+#define CARGO_JSON_INTERNALS_FROM_JSON_STREAM_VISITOR_HPP
+
+#include "cargo/internals/is-visitable.hpp"
+#include "cargo/internals/has-field-table.hpp"
+#include "cargo/internals/is-like-tuple.hpp"
+#include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/field-table.hpp"
+#include "cargo/internals/visit-fields.hpp"
+#include "cargo/internals/field-path.hpp"
+#include "cargo-json/internals/json-reader.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Reads the json text once, without building a document tree.
+ *
+ * Fields of the classes registered with CARGO_REGISTER are read in the order of the keys:
+ * each key is looked up in the field table and its value is parsed into the field right away.
+ *
+ * Other visitables get the fields in the order of their visits. Keys met before their visit
+ * are remembered with the position of their value, which is parsed when the field is visited.
+ *
+ * Unknown fields are skipped.
+ */
+class FromJsonStreamVisitor {
+public:
+    /**
+     * Fills the visitable with the json object in the text
+     */
+    template<typename T>
+    static void load(const char* begin, const char* end, T& value)
+    {
+        JsonReader reader(begin, end);
+        if (reader.isEnd()) {
+            JsonReader::throwParsingError();
+        }
+        read(reader, value);
+        if (!reader.isEnd()) {
+            JsonReader::throwParsingError();
+        }
+    }
+
+    /**
+     * Fills only the fields at the paths, see visitFieldPath.
+     * For each field the text is read only up to the field, other values are skipped.
+     */
+    template<typename T>
+    static void loadFields(const char* begin,
+                           const char* end,
+                           T& value,
+                           const std::vector<std::string>& paths)
+    {
+        PathReader pathReader{begin, end};
+        for (const std::string& path : paths) {
+            visitFieldPath(value, path, pathReader);
+        }
+    }
+
+    template<typename T>
+    void visit(const FieldName& name, T& value)
+    {
+        for (auto it = mObject->skipped.begin(); it != mObject->skipped.end(); ++it) {
+            if (it->first == name) {
+                JsonReader reader = mObject->reader.at(it->second);
+                mObject->skipped.erase(it);
+                read(reader, value);
+                return;
+            }
+        }
+
+        while (nextKey(*mObject)) {
+            if (isKey(name)) {
+                read(mObject->reader, value);
+                return;
+            }
+            mObject->skipped.emplace_back(getKey(), mObject->reader.position());
+            mObject->reader.skipValue();
+        }
+        throw CargoException("Missing field '" + name.str() + "'");
+    }
+
+private:
+    // State of the object being read, shared by the copies of the visitor
+    struct Object {
+        explicit Object(JsonReader& reader)
+            : reader(reader), isFirst(true), isClosed(false), keyHasEscapes(false)
+        {
+        }
+
+        JsonReader& reader;
+        bool isFirst;
+        bool isClosed;
+        // Last read key
+        const char* keyBegin;
+        const char* keyEnd;
+        bool keyHasEscapes;
+        std::string keyBuffer;
+        // Keys read before their visit and positions of their values
+        std::vector<std::pair<std::string, const char*>> skipped;
+    };
+
+    Object* mObject;
+
+    // Reads the fields selected by visitFieldPath
+    struct PathReader {
+        const char* begin;
+        const char* end;
+
+        template<typename T>
+        void visitPath(const std::string& parentPath, const FieldName& name, T& value)
+        {
+            JsonReader reader(begin, end);
+            if (reader.isEnd()) {
+                JsonReader::throwParsingError();
+            }
+            for (std::size_t nameBegin = 0; nameBegin < parentPath.size();) {
+                const std::size_t nameEnd = std::min(parentPath.find('.', nameBegin), parentPath.size());
+                findKey(reader, parentPath.data() + nameBegin, nameEnd - nameBegin);
+                nameBegin = nameEnd + 1;
+            }
+            findKey(reader, name.data(), name.size());
+            read(reader, value);
+        }
+    };
+
+
+    explicit FromJsonStreamVisitor(Object& object)
+        : mObject(&object)
+    {
+    }
+
+    /**
+     * Reads the next key and the colon after it
+     *
+     * @return false at the end of the object
+     */
+    static bool nextKey(Object& object)
+    {
+        if (object.isClosed) {
+            return false;
+        }
+        if (object.reader.consume('}')) {
+            object.isClosed = true;
+            return false;
+        }
+        if (!object.isFirst) {
+            object.reader.expect(',');
+        }
+        object.isFirst = false;
+
+        object.keyHasEscapes = object.reader.readRawString(object.keyBegin, object.keyEnd);
+        if (object.keyHasEscapes) {
+            JsonReader::unescape(object.keyBegin, object.keyEnd, object.keyBuffer);
+        }
+        object.reader.expect(':');
+        return true;
+    }
+
+    /**
+     * Moves the reader to the value of the key in the object starting at the reader
+     */
+    static void findKey(JsonReader& reader, const char* name, const std::size_t size)
+    {
+        if (reader.peek() != '{') {
+            throwInvalidType();
+        }
+        reader.expect('{');
+
+        Object object(reader);
+        while (nextKey(object)) {
+            const bool isFound = object.keyHasEscapes ?
+                object.keyBuffer.size() == size && object.keyBuffer.compare(0, size, name, size) == 0 :
+                static_cast<std::size_t>(object.keyEnd - object.keyBegin) == size &&
+                    std::memcmp(object.keyBegin, name, size) == 0;
+            if (isFound) {
+                return;
+            }
+            reader.skipValue();
+        }
+        throw CargoException("Missing field '" + std::string(name, size) + "'");
+    }
+
+    bool isKey(const FieldName& name) const
+    {
+        if (mObject->keyHasEscapes) {
+            return mObject->keyBuffer == name;
+        }
+        return name.equals(mObject->keyBegin, static_cast<std::size_t>(mObject->keyEnd - mObject->keyBegin));
+    }
+
+    std::string getKey() const
+    {
+        if (mObject->keyHasEscapes) {
+            return mObject->keyBuffer;
+        }
+        return std::string(mObject->keyBegin, mObject->keyEnd);
+    }
+
+    static void throwInvalidType()
+    {
+        throw CargoException("Invalid field type");
+    }
+
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    static void read(JsonReader& reader, T& value)
+    {
+        bool isNegative;
+        std::uint64_t magnitude;
+        if (!reader.readInteger(isNegative, magnitude)) {
+            throwInvalidType();
+        }
+
+        // Magnitude of the minimal value, computed without overflowing
+        const std::uint64_t maxNegative = std::is_signed<T>::value ?
+            static_cast<std::uint64_t>(-(std::numeric_limits<T>::min() + 1)) + 1 : 0;
+        if (isNegative ? magnitude > maxNegative :
+                         magnitude > static_cast<std::uint64_t>(std::numeric_limits<T>::max())) {
+            throw CargoException("Value out of range");
+        }
+        // Negating in unsigned arithmetic works for the minimal value too
+        value = static_cast<T>(isNegative ? 0 - magnitude : magnitude);
+    }
+
+    static void read(JsonReader& reader, bool& value)
+    {
+        if (!reader.readBool(value)) {
+            throwInvalidType();
+        }
+    }
+
+    static void read(JsonReader& reader, double& value)
+    {
+        if (!reader.readDouble(value)) {
+            throwInvalidType();
+        }
+    }
+
+    static void read(JsonReader& reader, std::string& value)
+    {
+        if (reader.peek() != '"') {
+            throwInvalidType();
+        }
+        reader.readString(value);
+    }
+
+    static void read(JsonReader& reader, char* &value)
+    {
+        std::string buffer;
+        read(reader, buffer);
+        value = new char[buffer.size() + 1];
+        std::memcpy(value, buffer.c_str(), buffer.size() + 1);
+    }
+
+    static void beginArray(JsonReader& reader)
+    {
+        if (reader.peek() != '[') {
+            throwInvalidType();
+        }
+        reader.expect('[');
+    }
+
+    // Elements over the expected number are ignored
+    static void endArray(JsonReader& reader, const bool isEmpty)
+    {
+        if (reader.consume(']')) {
+            return;
+        }
+        if (!isEmpty) {
+            reader.expect(',');
+        }
+        do {
+            reader.skipValue();
+        } while (reader.consume(','));
+        reader.expect(']');
+    }
+
+    // Moves to the next element of a fixed size array, which has to be there
+    static void nextElement(JsonReader& reader, const std::size_t index)
+    {
+        if (reader.peek() == ']') {
+            throwInvalidType();
+        }
+        if (index > 0) {
+            reader.expect(',');
+        }
+    }
+
+    template<typename T>
+    static void read(JsonReader& reader, std::vector<T>& values)
+    {
+        beginArray(reader);
+        values.clear();
+        if (reader.consume(']')) {
+            return;
+        }
+        do {
+            values.emplace_back();
+            read(reader, values.back());
+        } while (reader.consume(','));
+        reader.expect(']');
+    }
+
+    template<typename T, std::size_t N>
+    static void read(JsonReader& reader, std::array<T, N>& values)
+    {
+        beginArray(reader);
+        for (std::size_t i = 0; i < N; ++i) {
+            nextElement(reader, i);
+            read(reader, values[i]);
+        }
+        endArray(reader, N == 0);
+    }
+
+    template<typename V>
+    static void read(JsonReader& reader, std::map<std::string, V>& values)
+    {
+        if (reader.peek() != '{') {
+            throwInvalidType();
+        }
+        reader.expect('{');
+        if (reader.consume('}')) {
+            return;
+        }
+        std::string key;
+        do {
+            reader.readString(key);
+            reader.expect(':');
+            read(reader, values[key]);
+        } while (reader.consume(','));
+        reader.expect('}');
+    }
+
+    struct HelperVisitor
+    {
+        template<typename T>
+        static void visit(JsonReader* reader, std::size_t* index, T&& value)
+        {
+            nextElement(*reader, *index);
+            read(*reader, value);
+            *index += 1;
+        }
+    };
+
+    template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
+    static void read(JsonReader& reader, T& values)
+    {
+        beginArray(reader);
+        std::size_t index = 0;
+        HelperVisitor visitor;
+        visitFields(values, &visitor, &reader, &index);
+        endArray(reader, index == 0);
+    }
+
+    template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    static void read(JsonReader& reader, T& value)
+    {
+        read(reader, *reinterpret_cast<typename std::underlying_type<T>::type*>(&value));
+    }
+
+    // Reads the visited field from the current position
+    struct FieldReader {
+        JsonReader* reader;
+
+        template<typename T>
+        void visit(const FieldName&, T& value)
+        {
+            read(*reader, value);
+        }
+    };
+
+    // Which fields were read, doesn't allocate for up to 64 fields
+    class ReadFields {
+    public:
+        explicit ReadFields(const std::size_t size)
+            : mMask(0), mFields(size > 64 ? size : 0)
+        {
+        }
+
+        void set(const std::size_t index)
+        {
+            if (mFields.empty()) {
+                mMask |= std::uint64_t(1) << index;
+            } else {
+                mFields[index] = true;
+            }
+        }
+
+        bool test(const std::size_t index) const
+        {
+            return mFields.empty() ? (mMask >> index) & 1 : mFields[index];
+        }
+
+    private:
+        std::uint64_t mMask;
+        std::vector<bool> mFields;
+    };
+
+    template<typename T,
+             typename std::enable_if<isVisitable<T>::value && hasFieldTable<T>::value, int>::type = 0>
+    static void read(JsonReader& reader, T& value)
+    {
+        if (reader.peek() != '{') {
+            throwInvalidType();
+        }
+        reader.expect('{');
+
+        const FieldTable& table = T::getFieldTable();
+        ReadFields readFields(table.size());
+        Object object(reader);
+        FieldReader fieldReader{&reader};
+        while (nextKey(object)) {
+            const std::size_t index = object.keyHasEscapes ?
+                table.find(object.keyBuffer) :
+                table.find(object.keyBegin, static_cast<std::size_t>(object.keyEnd - object.keyBegin));
+            if (index == table.size()) {
+                reader.skipValue();
+                continue;
+            }
+            value.acceptField(index, fieldReader);
+            readFields.set(index);
+        }
+
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            // Base class fields hidden by a field with the same name can't be read
+            if (!readFields.test(i) && table.find(table[i].data(), table[i].size()) == i) {
+                throw CargoException("Missing field '" + table[i].str() + "'");
+            }
+        }
+    }
+
+    template<typename T,
+             typename std::enable_if<isVisitable<T>::value && !hasFieldTable<T>::value, int>::type = 0>
+    static void read(JsonReader& reader, T& value)
+    {
+        if (reader.peek() != '{') {
+            throwInvalidType();
+        }
+        reader.expect('{');
+
+        Object object(reader);
+        FromJsonStreamVisitor visitor(object);
+        value.accept(visitor);
+
+        // Skip the fields that weren't visited
+        while (nextKey(object)) {
+            reader.skipValue();
+        }
+    }
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_JSON_INTERNALS_FROM_JSON_STREAM_VISITOR_HPP
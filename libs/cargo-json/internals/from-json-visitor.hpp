@@ -28,6 +28,7 @@
 #include "cargo/internals/is-visitable.hpp"
 #include "cargo/internals/is-like-tuple.hpp"
 #include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/internals/visit-fields.hpp"
 
 #include <json.h>
@@ -53,6 +54,27 @@ public:
         }
     }
 
+    /**
+     * @param data  json text, doesn't have to be null terminated
+     * @param size  size of the text
+     */
+    FromJsonVisitor(const char* data, const std::size_t size)
+        : mObject(nullptr)
+    {
+        if (size > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+            throw CargoException("Json parsing error");
+        }
+        json_tokener* tokener = json_tokener_new();
+        if (tokener == nullptr) {
+            throw CargoException("Json parsing error");
+        }
+        mObject = json_tokener_parse_ex(tokener, data, static_cast<int>(size));
+        json_tokener_free(tokener);
+        if (mObject == nullptr) {
+            throw CargoException("Json parsing error");
+        }
+    }
+
     FromJsonVisitor(const FromJsonVisitor& visitor)
         : mObject(json_object_get(visitor.mObject))
     {
@@ -66,11 +88,11 @@ public:
     FromJsonVisitor& operator=(const FromJsonVisitor&) = delete;
 
     template<typename T>
-    void visit(const std::string& name, T& value)
+    void visit(const FieldName& name, T& value)
     {
         json_object* object = nullptr;
         if (!json_object_object_get_ex(mObject, name.c_str(), &object)) {
-            throw CargoException("Missing field '" + name + "'");
+            throw CargoException("Missing field '" + name.str() + "'");
         }
         fromJsonObject(object, value);
     }
@@ -0,0 +1,469 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Pull parser of the json text
+ */
+
+#ifndef CARGO_JSON_INTERNALS_JSON_READER_HPP
+#define CARGO_JSON_INTERNALS_JSON_READER_HPP
+
+#include "cargo/exception.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Reads the json text token by token, nothing is copied unless asked for.
+ * The text doesn't have to be null terminated.
+ *
+ * Like json-c it accepts C and C++ style comments.
+ * Syntax errors throw CargoException("Json parsing error").
+ */
+class JsonReader {
+public:
+    JsonReader(const char* begin, const char* end)
+        : mPos(begin), mEnd(end)
+    {
+    }
+
+    const char* position() const
+    {
+        return mPos;
+    }
+
+    /**
+     * @return reader of the same text starting at the given position
+     */
+    JsonReader at(const char* position) const
+    {
+        return JsonReader(position, mEnd);
+    }
+
+    bool isEnd()
+    {
+        skipSpace();
+        return mPos == mEnd;
+    }
+
+    /**
+     * Skips white spaces and comments
+     *
+     * @return next character, '\0' at the end of the text
+     */
+    char peek()
+    {
+        skipSpace();
+        return mPos == mEnd ? '\0' : *mPos;
+    }
+
+    bool consume(const char c)
+    {
+        if (peek() != c) {
+            return false;
+        }
+        ++mPos;
+        return true;
+    }
+
+    void expect(const char c)
+    {
+        if (!consume(c)) {
+            throwParsingError();
+        }
+    }
+
+    /**
+     * Reads the string without unescaping it
+     *
+     * @param begin         first character after the opening quote
+     * @param end           the closing quote
+     * @return              true if the string contains escape sequences
+     */
+    bool readRawString(const char*& begin, const char*& end)
+    {
+        expect('"');
+        begin = mPos;
+        bool hasEscapes = false;
+        for (; mPos != mEnd; ++mPos) {
+            if (*mPos == '"') {
+                end = mPos++;
+                return hasEscapes;
+            }
+            if (*mPos == '\\') {
+                hasEscapes = true;
+                if (++mPos == mEnd) {
+                    break;
+                }
+            }
+        }
+        throwParsingError();
+        return false;
+    }
+
+    /**
+     * Reads and unescapes the string
+     */
+    void readString(std::string& value)
+    {
+        const char* begin;
+        const char* end;
+        if (!readRawString(begin, end)) {
+            value.assign(begin, end);
+            return;
+        }
+        unescape(begin, end, value);
+    }
+
+    /**
+     * @return false if the next value is not an integer, the value is not consumed then
+     */
+    bool readInteger(bool& isNegative, std::uint64_t& magnitude)
+    {
+        const char* begin;
+        const char* end;
+        if (!scanNumber(begin, end) || !isInteger(begin, end)) {
+            return false;
+        }
+
+        isNegative = *begin == '-';
+        magnitude = 0;
+        for (const char* it = isNegative ? begin + 1 : begin; it != end; ++it) {
+            const std::uint64_t digit = static_cast<std::uint64_t>(*it - '0');
+            if (magnitude > (UINT64_MAX - digit) / 10) {
+                throw CargoException("Value out of range");
+            }
+            magnitude = magnitude * 10 + digit;
+        }
+        mPos = end;
+        return true;
+    }
+
+    /**
+     * @return false if the next value is not a number with a fraction or an exponent,
+     *         the value is not consumed then
+     */
+    bool readDouble(double& value)
+    {
+        const char* begin;
+        const char* end;
+        if (!scanNumber(begin, end) || isInteger(begin, end)) {
+            return false;
+        }
+
+        // strtod needs a null terminated string, the numbers can be long
+        const std::size_t size = static_cast<std::size_t>(end - begin);
+        char buffer[64];
+        std::string longBuffer;
+        const char* number = buffer;
+        if (size < sizeof(buffer)) {
+            std::memcpy(buffer, begin, size);
+            buffer[size] = '\0';
+        } else {
+            longBuffer.assign(begin, end);
+            number = longBuffer.c_str();
+        }
+        value = std::strtod(number, nullptr);
+        mPos = end;
+        return true;
+    }
+
+    /**
+     * @return false if the next value is not a boolean, the value is not consumed then
+     */
+    bool readBool(bool& value)
+    {
+        if (consumeLiteral("true")) {
+            value = true;
+            return true;
+        }
+        if (consumeLiteral("false")) {
+            value = false;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Checks the syntax of the next value and moves past it
+     */
+    void skipValue(const unsigned int depth = 0)
+    {
+        if (depth > MAX_DEPTH) {
+            throwParsingError();
+        }
+
+        const char* begin;
+        const char* end;
+        switch (peek()) {
+        case '"':
+            readRawString(begin, end);
+            return;
+        case '{':
+            ++mPos;
+            if (consume('}')) {
+                return;
+            }
+            do {
+                readRawString(begin, end);
+                expect(':');
+                skipValue(depth + 1);
+            } while (consume(','));
+            expect('}');
+            return;
+        case '[':
+            ++mPos;
+            if (consume(']')) {
+                return;
+            }
+            do {
+                skipValue(depth + 1);
+            } while (consume(','));
+            expect(']');
+            return;
+        default:
+            if (scanNumber(begin, end)) {
+                mPos = end;
+                return;
+            }
+            if (!consumeLiteral("true") && !consumeLiteral("false") && !consumeLiteral("null")) {
+                throwParsingError();
+            }
+        }
+    }
+
+    /**
+     * Decodes the escape sequences of the raw string
+     */
+    static void unescape(const char* begin, const char* end, std::string& value)
+    {
+        value.clear();
+        value.reserve(static_cast<std::size_t>(end - begin));
+        const char* it = begin;
+        while (it != end) {
+            const char* escape = static_cast<const char*>(std::memchr(it, '\\', static_cast<std::size_t>(end - it)));
+            if (escape == nullptr) {
+                value.append(it, end);
+                return;
+            }
+            value.append(it, escape);
+            it = escape + 1;
+
+            switch (*it++) {
+            case '"': value.push_back('"'); break;
+            case '\\': value.push_back('\\'); break;
+            case '/': value.push_back('/'); break;
+            case 'b': value.push_back('\b'); break;
+            case 'f': value.push_back('\f'); break;
+            case 'n': value.push_back('\n'); break;
+            case 'r': value.push_back('\r'); break;
+            case 't': value.push_back('\t'); break;
+            case 'u': {
+                unsigned int codePoint = readHex4(it, end);
+                if (codePoint >= 0xdc00 && codePoint < 0xe000) {
+                    throwParsingError();
+                }
+                if (codePoint >= 0xd800 && codePoint < 0xdc00) {
+                    // Surrogate pair
+                    if (end - it < 2 || it[0] != '\\' || it[1] != 'u') {
+                        throwParsingError();
+                    }
+                    it += 2;
+                    const unsigned int low = readHex4(it, end);
+                    if (low < 0xdc00 || low >= 0xe000) {
+                        throwParsingError();
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+                }
+                appendUtf8(value, codePoint);
+                break;
+            }
+            default:
+                throwParsingError();
+            }
+        }
+    }
+
+    static void throwParsingError()
+    {
+        throw CargoException("Json parsing error");
+    }
+
+private:
+    // Nesting limit of the skipped values
+    static const unsigned int MAX_DEPTH = 256;
+
+    const char* mPos;
+    const char* mEnd;
+
+    void skipSpace()
+    {
+        while (mPos != mEnd) {
+            const char c = *mPos;
+            if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+                ++mPos;
+            } else if (c == '/' && mEnd - mPos > 1 && mPos[1] == '*') {
+                const char* commentEnd = mPos + 2;
+                while (commentEnd < mEnd - 1 && !(commentEnd[0] == '*' && commentEnd[1] == '/')) {
+                    ++commentEnd;
+                }
+                if (commentEnd >= mEnd - 1) {
+                    throwParsingError();
+                }
+                mPos = commentEnd + 2;
+            } else if (c == '/' && mEnd - mPos > 1 && mPos[1] == '/') {
+                while (mPos != mEnd && *mPos != '\n') {
+                    ++mPos;
+                }
+            } else {
+                return;
+            }
+        }
+    }
+
+    bool consumeLiteral(const char* literal)
+    {
+        const std::size_t size = std::strlen(literal);
+        if (peek() != literal[0] ||
+            static_cast<std::size_t>(mEnd - mPos) < size ||
+            std::memcmp(mPos, literal, size) != 0) {
+            return false;
+        }
+        mPos += size;
+        return true;
+    }
+
+    static bool isDigit(const char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool isInteger(const char* begin, const char* end)
+    {
+        for (const char* it = begin; it != end; ++it) {
+            if (*it == '.' || *it == 'e' || *it == 'E') {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Finds the end of the number at the current position, doesn't consume it
+     *
+     * @return false if there's no number at the current position
+     */
+    bool scanNumber(const char*& begin, const char*& end)
+    {
+        const char c = peek();
+        if (c != '-' && !isDigit(c)) {
+            return false;
+        }
+
+        begin = mPos;
+        const char* it = mPos;
+        if (*it == '-') {
+            ++it;
+        }
+        const char* digits = it;
+        while (it != mEnd && isDigit(*it)) {
+            ++it;
+        }
+        if (it == digits) {
+            throwParsingError();
+        }
+        if (it != mEnd && *it == '.') {
+            digits = ++it;
+            while (it != mEnd && isDigit(*it)) {
+                ++it;
+            }
+            if (it == digits) {
+                throwParsingError();
+            }
+        }
+        if (it != mEnd && (*it == 'e' || *it == 'E')) {
+            ++it;
+            if (it != mEnd && (*it == '+' || *it == '-')) {
+                ++it;
+            }
+            digits = it;
+            while (it != mEnd && isDigit(*it)) {
+                ++it;
+            }
+            if (it == digits) {
+                throwParsingError();
+            }
+        }
+        end = it;
+        return true;
+    }
+
+    static unsigned int readHex4(const char*& it, const char* end)
+    {
+        if (end - it < 4) {
+            throwParsingError();
+        }
+        unsigned int value = 0;
+        for (int i = 0; i < 4; ++i, ++it) {
+            const char c = *it;
+            value <<= 4;
+            if (c >= '0' && c <= '9') {
+                value |= static_cast<unsigned int>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value |= static_cast<unsigned int>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                value |= static_cast<unsigned int>(c - 'A' + 10);
+            } else {
+                throwParsingError();
+            }
+        }
+        return value;
+    }
+
+    static void appendUtf8(std::string& value, const unsigned int codePoint)
+    {
+        if (codePoint < 0x80) {
+            value.push_back(static_cast<char>(codePoint));
+        } else if (codePoint < 0x800) {
+            value.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+            value.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        } else if (codePoint < 0x10000) {
+            value.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+            value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+            value.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        } else {
+            value.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+            value.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+            value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+            value.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        }
+    }
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_JSON_INTERNALS_JSON_READER_HPP
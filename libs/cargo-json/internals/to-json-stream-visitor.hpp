@@ -0,0 +1,275 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   JSON visitor writing the text directly into a string
+ */
+
+#ifndef CARGO_JSON_INTERNALS_TO_JSON_STREAM_VISITOR_HPP
+#define CARGO_JSON_INTERNALS_TO_JSON_STREAM_VISITOR_HPP
+
+#include "cargo/internals/is-visitable.hpp"
+#include "cargo/internals/is-like-tuple.hpp"
+#include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/internals/visit-fields.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Writes the same text as json_object_to_json_string() of the ToJsonVisitor's tree,
+ * without building the tree.
+ *
+ * Copies of the visitor write to the same string.
+ */
+class ToJsonStreamVisitor {
+
+public:
+    explicit ToJsonStreamVisitor(std::string& out)
+        : mOut(&out), mIsFirst(true)
+    {
+    }
+
+    template<typename T>
+    void visit(const FieldName& name, const T& value)
+    {
+        mOut->append(mIsFirst ? " " : ", ");
+        mIsFirst = false;
+        writeString(*mOut, name.data(), name.size());
+        mOut->append(": ");
+        write(*mOut, value);
+    }
+
+    /**
+     * Appends the visitable as a json object
+     */
+    template<typename T>
+    static void writeObject(std::string& out, const T& value)
+    {
+        out.push_back('{');
+        ToJsonStreamVisitor visitor(out);
+        value.accept(visitor);
+        out.append(" }");
+    }
+
+private:
+    std::string* mOut;
+    bool mIsFirst;
+
+
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    static void write(std::string& out, T value)
+    {
+        write(out, static_cast<std::int64_t>(value));
+    }
+
+    static void write(std::string& out, std::int64_t value)
+    {
+        // Negating in unsigned arithmetic works for INT64_MIN too
+        std::uint64_t absolute = static_cast<std::uint64_t>(value);
+        if (value < 0) {
+            out.push_back('-');
+            absolute = 0 - absolute;
+        }
+        writeDigits(out, absolute);
+    }
+
+    static void write(std::string& out, std::uint64_t value)
+    {
+        if (value > INT64_MAX) {
+            throw CargoException("Value out of range");
+        }
+        writeDigits(out, value);
+    }
+
+    static void writeDigits(std::string& out, std::uint64_t value)
+    {
+        char digits[20];
+        std::size_t size = 0;
+        do {
+            digits[size++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        while (size > 0) {
+            out.push_back(digits[--size]);
+        }
+    }
+
+    static void write(std::string& out, bool value)
+    {
+        out.append(value ? "true" : "false");
+    }
+
+    // Formats like json-c: %.17g, with ".0" added to the integral values
+    static void write(std::string& out, double value)
+    {
+        if (std::isnan(value)) {
+            out.append("NaN");
+            return;
+        }
+        if (std::isinf(value)) {
+            out.append(value < 0 ? "-Infinity" : "Infinity");
+            return;
+        }
+
+        char buffer[32];
+        const int size = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        // Decimal comma of the locale
+        char* comma = std::strchr(buffer, ',');
+        if (comma != nullptr) {
+            *comma = '.';
+        }
+        out.append(buffer, static_cast<std::size_t>(size));
+        if (std::strpbrk(buffer, ".e") == nullptr) {
+            out.append(".0");
+        }
+    }
+
+    static void write(std::string& out, const std::string& value)
+    {
+        writeString(out, value.data(), value.size());
+    }
+
+    static void write(std::string& out, char* value)
+    {
+        writeString(out, value, std::char_traits<char>::length(value));
+    }
+
+    // Escapes like json-c: control characters, quotes, backslashes and slashes
+    static void writeString(std::string& out, const char* value, const std::size_t size)
+    {
+        static const char HEX[] = "0123456789abcdef";
+
+        out.push_back('"');
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            const unsigned char c = static_cast<unsigned char>(value[i]);
+            if (c >= ' ' && c != '"' && c != '\\' && c != '/') {
+                continue;
+            }
+
+            out.append(value + begin, i - begin);
+            begin = i + 1;
+            switch (c) {
+            case '\b': out.append("\\b"); break;
+            case '\n': out.append("\\n"); break;
+            case '\r': out.append("\\r"); break;
+            case '\t': out.append("\\t"); break;
+            case '\f': out.append("\\f"); break;
+            case '"': out.append("\\\""); break;
+            case '\\': out.append("\\\\"); break;
+            case '/': out.append("\\/"); break;
+            default:
+                const char escaped[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xf]};
+                out.append(escaped, sizeof(escaped));
+            }
+        }
+        out.append(value + begin, size - begin);
+        out.push_back('"');
+    }
+
+    template<typename Iterator>
+    static void writeArray(std::string& out, Iterator begin, Iterator end)
+    {
+        out.push_back('[');
+        for (Iterator it = begin; it != end; ++it) {
+            out.append(it == begin ? " " : ", ");
+            write(out, *it);
+        }
+        out.append(" ]");
+    }
+
+    template<typename T>
+    static void write(std::string& out, const std::vector<T>& values)
+    {
+        writeArray(out, values.begin(), values.end());
+    }
+
+    template<typename T, std::size_t N>
+    static void write(std::string& out, const std::array<T, N>& values)
+    {
+        writeArray(out, values.begin(), values.end());
+    }
+
+    template<typename V>
+    static void write(std::string& out, const std::map<std::string, V>& values)
+    {
+        out.push_back('{');
+        for (auto it = values.begin(); it != values.end(); ++it) {
+            out.append(it == values.begin() ? " " : ", ");
+            writeString(out, it->first.data(), it->first.size());
+            out.append(": ");
+            write(out, it->second);
+        }
+        out.append(" }");
+    }
+
+    struct HelperVisitor
+    {
+        template<typename T>
+        static void visit(std::string* out, bool* isFirst, const T& value)
+        {
+            out->append(*isFirst ? " " : ", ");
+            *isFirst = false;
+            write(*out, value);
+        }
+    };
+
+    template<typename T, typename std::enable_if<isLikeTuple<T>::value, int>::type = 0>
+    static void write(std::string& out, const T& values)
+    {
+        out.push_back('[');
+        bool isFirst = true;
+        HelperVisitor visitor;
+        visitFields(values, &visitor, &out, &isFirst);
+        out.append(" ]");
+    }
+
+    template<typename T, typename std::enable_if<isVisitable<T>::value, int>::type = 0>
+    static void write(std::string& out, const T& value)
+    {
+        writeObject(out, value);
+    }
+
+    template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    static void write(std::string& out, const T& value)
+    {
+        write(out, static_cast<const typename std::underlying_type<T>::type>(value));
+    }
+
+};
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_JSON_INTERNALS_TO_JSON_STREAM_VISITOR_HPP
@@ -28,6 +28,7 @@
 #include "cargo/internals/is-visitable.hpp"
 #include "cargo/internals/is-like-tuple.hpp"
 #include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/internals/visit-fields.hpp"
 
 #include <array>
@@ -68,9 +69,14 @@ public:
     }
 
     template<typename T>
-    void visit(const std::string& name, const T& value)
+    void visit(const FieldName& name, const T& value)
     {
+#ifdef JSON_C_OBJECT_KEY_IS_CONSTANT
+        // Names are string literals, json-c doesn't have to copy them
+        json_object_object_add_ex(mObject, name.c_str(), toJsonObject(value), JSON_C_OBJECT_KEY_IS_CONSTANT);
+#else
         json_object_object_add(mObject, name.c_str(), toJsonObject(value));
+#endif
     }
 private:
     json_object* mObject;
@@ -109,11 +115,8 @@ private:
 
     static json_object* toJsonObject(double value)
     {
-#if JSON_C_MINOR_VERSION >= 12
-        return json_object_new_double_s(value, std::to_string(value).c_str());
-#else
+        // Written by json-c with %.17g, the value is read back unchanged
         return json_object_new_double(value);
-#endif
     }
 
     static json_object* toJsonObject(const std::string& value)
@@ -26,7 +26,7 @@
 #ifndef CARGO_SQLITE_JSON_CARGO_SQLITE_JSON_HPP
 #define CARGO_SQLITE_JSON_CARGO_SQLITE_JSON_HPP
 
-#include "utils/fs.hpp"
+#include "utils/mapped-file.hpp"
 #include "cargo-json/internals/to-json-visitor.hpp"
 #include "cargo-sqlite/internals/to-kvstore-visitor.hpp"
 #include "cargo-json/internals/from-json-visitor.hpp"
@@ -36,6 +36,32 @@
 
 namespace cargo {
 
+namespace internals {
+
+/**
+ * @param jsonData  json text with defaults, doesn't have to be null terminated
+ * @param jsonSize  size of the json text
+ */
+template <class Cargo>
+void loadFromKVStoreWithJsonBuffer(const std::string& kvfile,
+                                   const char* jsonData,
+                                   const std::size_t jsonSize,
+                                   Cargo& visitable,
+                                   const std::string& kvVisitableName)
+{
+    static_assert(isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    KVStore store(kvfile);
+    KVStore::Transaction transaction(store);
+    FromJsonVisitor fromJsonVisitor(jsonData, jsonSize);
+    FromKVStoreIgnoringVisitor fromKVStoreVisitor(store, kvVisitableName);
+    visitable.accept(fromJsonVisitor);
+    visitable.accept(fromKVStoreVisitor);
+    transaction.commit();
+}
+
+} // namespace internals
+
 /*@{*/
 
 /**
@@ -52,19 +78,12 @@ void loadFromKVStoreWithJson(const std::string& kvfile,
                              Cargo& visitable,
                              const std::string& kvVisitableName)
 {
-    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
-
-    internals::KVStore store(kvfile);
-    internals::KVStore::Transaction transaction(store);
-    internals::FromJsonVisitor fromJsonVisitor(json);
-    internals::FromKVStoreIgnoringVisitor fromKVStoreVisitor(store, kvVisitableName);
-    visitable.accept(fromJsonVisitor);
-    visitable.accept(fromKVStoreVisitor);
-    transaction.commit();
+    internals::loadFromKVStoreWithJsonBuffer(kvfile, json.data(), json.size(), visitable, kvVisitableName);
 }
 
 /**
- * Load the data from KVStore with defaults given in json file
+ * Load the data from KVStore with defaults given in json file.
+ * The json file is mapped into memory and parsed without copying it.
  *
  * @param kvfile            path to the KVStore db
  * @param jsonfile          path to json file with defaults
@@ -77,9 +96,9 @@ void loadFromKVStoreWithJsonFile(const std::string& kvfile,
                                  Cargo& visitable,
                                  const std::string& kvVisitableName)
 {
-    const std::string content = utils::readFileContent(jsonfile);
+    const utils::MappedFile file(jsonfile);
     try {
-        loadFromKVStoreWithJson(kvfile, content, visitable, kvVisitableName);
+        internals::loadFromKVStoreWithJsonBuffer(kvfile, file.data(), file.size(), visitable, kvVisitableName);
     } catch (CargoException& e) {
         throw CargoException("Error in " + jsonfile + ": " + e.what());
     }
@@ -29,6 +29,11 @@
 #include "cargo-sqlite/internals/to-kvstore-visitor.hpp"
 #include "cargo-sqlite/internals/from-kvstore-visitor.hpp"
 #include "cargo-sqlite/internals/from-kvstore-ignoring-visitor.hpp"
+#include "cargo/internals/field-path.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
 
 namespace cargo {
 
@@ -54,24 +59,85 @@ void loadFromKVStore(const std::string& filename, Cargo& visitable, const std::s
 }
 
 /**
- * Saves the visitable to a KVStore.
+ * Loads only the selected fields of a visitable structure from KVStore,
+ * the other fields are left untouched. Only the keys of the selected fields are read.
  *
  * @param filename      path to the KVStore db
- * @param visitable     visitable structure to save
+ * @param visitable     visitable structure to load
  * @param visitableName name of the structure inside the KVStore db
+ * @param paths         paths of the fields, names separated by dots, e.g. {"network.mtu", "limits"}
  */
 template <class Cargo>
-void saveToKVStore(const std::string& filename, const Cargo& visitable, const std::string& visitableName)
+void loadFieldsFromKVStore(const std::string& filename,
+                           Cargo& visitable,
+                           const std::string& visitableName,
+                           const std::vector<std::string>& paths)
 {
     static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
 
     internals::KVStore store(filename);
     internals::KVStore::Transaction transaction(store);
+    internals::FromKVStorePathVisitor visitor(store, visitableName);
+    for (const std::string& path : paths) {
+        internals::visitFieldPath(visitable, path, visitor);
+    }
+    transaction.commit();
+}
+
+/**
+ * Saves the visitable to a KVStore.
+ *
+ * @param filename             path to the KVStore db
+ * @param visitable            visitable structure to save
+ * @param visitableName        name of the structure inside the KVStore db
+ * @param compressionThreshold values at least that long are stored compressed, 0 disables the compression
+ */
+template <class Cargo>
+void saveToKVStore(const std::string& filename,
+                   const Cargo& visitable,
+                   const std::string& visitableName,
+                   const size_t compressionThreshold = 0)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    internals::KVStore store(filename);
+    store.setCompressionThreshold(compressionThreshold);
+    internals::KVStore::Transaction transaction(store);
     internals::ToKVStoreVisitor visitor(store, visitableName);
     visitable.accept(visitor);
     transaction.commit();
 }
 
+/**
+ * Saves the visitable to a KVStore, like saveToKVStore, but compares it with the stored one
+ * and writes only the changed values. Stale keys, e.g. of removed vector elements, are removed.
+ * Saving a big structure after a small change doesn't rewrite all its keys.
+ *
+ * @param filename             path to the KVStore db
+ * @param visitable            visitable structure to save
+ * @param visitableName        name of the structure inside the KVStore db
+ * @param compressionThreshold values at least that long are stored compressed, 0 disables the compression
+ * @return                     number of written and removed keys
+ */
+template <class Cargo>
+size_t saveChangesToKVStore(const std::string& filename,
+                            const Cargo& visitable,
+                            const std::string& visitableName,
+                            const size_t compressionThreshold = 0)
+{
+    static_assert(internals::isVisitable<Cargo>::value, "Use CARGO_REGISTER macro");
+
+    internals::KVStore store(filename);
+    store.setCompressionThreshold(compressionThreshold);
+    internals::KVStore::Transaction transaction(store);
+    std::map<std::string, std::string> values;
+    internals::ToKVStoreVisitor visitor(store, visitableName, values);
+    visitable.accept(visitor);
+    const size_t changes = store.replace(visitableName, values);
+    transaction.commit();
+    return changes;
+}
+
 } // namespace cargo
 
 /*@}*/
@@ -55,7 +55,7 @@ public:
     FromKVStoreVisitorBase& operator=(const FromKVStoreVisitorBase&) = delete;
 
     template<typename T>
-    void visit(const std::string& name, T& value)
+    void visit(const FieldName& name, T& value)
     {
         static_cast<RecursiveVisitor*>(this)->visitImpl(key(mKeyPrefix, name), value);
     }
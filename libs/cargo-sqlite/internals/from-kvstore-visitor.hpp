@@ -49,6 +49,32 @@ public:
     }
 };
 
+/**
+ * Loads the fields selected by internals::visitFieldPath, each with a few point lookups
+ */
+class FromKVStorePathVisitor {
+public:
+    FromKVStorePathVisitor(KVStore& store, const std::string& prefix)
+        : mStore(store),
+          mPrefix(prefix)
+    {
+    }
+
+    FromKVStorePathVisitor(const FromKVStorePathVisitor&) = delete;
+    FromKVStorePathVisitor& operator=(const FromKVStorePathVisitor&) = delete;
+
+    template<typename T>
+    void visitPath(const std::string& parentPath, const FieldName& name, T& value)
+    {
+        FromKVStoreVisitor visitor(mStore, parentPath.empty() ? mPrefix : mPrefix + '.' + parentPath);
+        visitor.visit(name, value);
+    }
+
+private:
+    KVStore& mStore;
+    std::string mPrefix;
+};
+
 } // namespace internals
 
 } // namespace cargo
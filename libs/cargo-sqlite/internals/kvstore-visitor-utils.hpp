@@ -25,6 +25,8 @@
 #ifndef CARGO_SQLITE_INTERNALS_KVSTORE_VISITOR_UTILS_HPP
 #define CARGO_SQLITE_INTERNALS_KVSTORE_VISITOR_UTILS_HPP
 
+#include "cargo/field-name.hpp"
+
 #include <vector>
 #include <string>
 #include <sstream>
@@ -82,6 +84,20 @@ std::string key()
     return std::string();
 }
 
+/**
+ * Key of the field in the structure stored under the prefix,
+ * the same as key(prefix, name) without the string streams.
+ */
+inline std::string key(const std::string& prefix, const FieldName& name)
+{
+    std::string ret;
+    ret.reserve(prefix.size() + 1 + name.size());
+    ret.append(prefix);
+    ret.push_back('.');
+    ret.append(name.data(), name.size());
+    return ret;
+}
+
 } // namespace internals
 
 } // namespace cargo
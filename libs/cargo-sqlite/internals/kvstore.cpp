@@ -26,12 +26,14 @@
 
 #include "cargo-sqlite/internals/kvstore.hpp"
 #include "cargo/exception.hpp"
+#include "cargo/internals/lz4.hpp"
 
 #include <exception>
 #include <limits>
 #include <memory>
 #include <set>
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 
 namespace cargo {
@@ -42,6 +44,8 @@ namespace {
 
 const int AUTO_DETERM_SIZE = -1;
 const int FIRST_COLUMN = 0;
+// Bound of the LZ4 compression ratio, protects from allocating memory for forged sizes
+const size_t MAX_COMPRESSION_RATIO = 255;
 
 struct ScopedReset {
     ScopedReset(std::unique_ptr<sqlite3::Statement>& stmtPtr)
@@ -97,6 +101,45 @@ void sqliteEscapeStr(::sqlite3_context* context, int argc, ::sqlite3_value** val
     sqlite3_result_text(context, out.c_str(), AUTO_DETERM_SIZE, SQLITE_TRANSIENT);
 }
 
+/**
+ * Compressed value: std::uint32_t size of the value followed by an LZ4 block
+ */
+std::string compress(const std::string& value)
+{
+    const std::uint32_t size = static_cast<std::uint32_t>(value.size());
+    std::string compressed(reinterpret_cast<const char*>(&size), sizeof(size));
+    lz4::compress(value.data(), value.size(), compressed);
+    return compressed;
+}
+
+std::string decompress(const char* data, const size_t size)
+{
+    std::uint32_t valueSize;
+    if (size < sizeof(valueSize)) {
+        throw CargoException("Compressed value is truncated");
+    }
+    std::memcpy(&valueSize, data, sizeof(valueSize));
+    if (valueSize / MAX_COMPRESSION_RATIO > size) {
+        throw CargoException("Compressed value has a wrong size: " + std::to_string(valueSize));
+    }
+
+    std::string value(valueSize, '\0');
+    lz4::decompress(data + sizeof(valueSize), size - sizeof(valueSize), &value[0], value.size());
+    return value;
+}
+
+std::string getColumnValue(sqlite3::Statement& stmt, const int column)
+{
+    if (::sqlite3_column_type(stmt.get(), column) == SQLITE_BLOB) {
+        // Only compressed values are stored as BLOBs
+        return decompress(static_cast<const char*>(sqlite3_column_blob(stmt.get(), column)),
+                          sqlite3_column_bytes(stmt.get(), column));
+    }
+    // Values may contain '\0', e.g. std::int8_t 0
+    const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), column));
+    return std::string(text, sqlite3_column_bytes(stmt.get(), column));
+}
+
 } // namespace
 
 KVStore::Transaction::Transaction(KVStore& kvStore)
@@ -139,6 +182,7 @@ void KVStore::Transaction::commit()
 KVStore::KVStore(const std::string& path)
     : mTransactionDepth(0),
       mIsTransactionCommited(false),
+      mCompressionThreshold(0),
       mPath(path),
       mConn(path)
 {
@@ -158,8 +202,18 @@ void KVStore::set(const std::string& key, const std::string& value)
     ScopedReset scopedReset(mSetValueStmt);
 
     ::sqlite3_bind_text(mSetValueStmt->get(), 1, key.c_str(), AUTO_DETERM_SIZE, SQLITE_STATIC);
-    ::sqlite3_bind_text(mSetValueStmt->get(), 2, value.c_str(), AUTO_DETERM_SIZE, SQLITE_STATIC);
 
+    std::string compressed;
+    if (mCompressionThreshold != 0 &&
+        value.size() >= mCompressionThreshold &&
+        value.size() <= std::numeric_limits<std::uint32_t>::max()) {
+        compressed = compress(value);
+    }
+    if (!compressed.empty() && compressed.size() < value.size()) {
+        ::sqlite3_bind_blob(mSetValueStmt->get(), 2, compressed.data(), compressed.size(), SQLITE_STATIC);
+    } else {
+        ::sqlite3_bind_text(mSetValueStmt->get(), 2, value.data(), value.size(), SQLITE_STATIC);
+    }
 
     if (::sqlite3_step(mSetValueStmt->get()) != SQLITE_DONE) {
         throw CargoException("Error during stepping: " + mConn.getErrorMessage());
@@ -182,8 +236,7 @@ std::string KVStore::get(const std::string& key)
         throw CargoException("Error during stepping: " + mConn.getErrorMessage());
     }
 
-    std::string value = reinterpret_cast<const char*>(
-            sqlite3_column_text(mGetValueStmt->get(), FIRST_COLUMN));
+    std::string value = getColumnValue(*mGetValueStmt, FIRST_COLUMN);
 
     transaction.commit();
     return value;
@@ -209,6 +262,12 @@ void KVStore::prepareStatements()
         new sqlite3::Statement(mConn, "INSERT OR REPLACE INTO data (key, value) VALUES (?,?)"));
     mRemoveValuesStmt.reset(
         new sqlite3::Statement(mConn, "DELETE FROM data WHERE key = ?1  OR key GLOB escapeStr(?1) ||'.*' "));
+    mRemoveValueStmt.reset(
+        new sqlite3::Statement(mConn, "DELETE FROM data WHERE key = ?"));
+    // Keys starting with ?1 || '.' are between ?1 || '.' and ?1 || '/', a range of the primary key index
+    mGetValuesStmt.reset(
+        new sqlite3::Statement(mConn, "SELECT key, value FROM data "
+                                      "WHERE key = ?1 OR (key > ?1 || '.' AND key < ?1 || '/')"));
     mGetKeysStmt.reset(
         new sqlite3::Statement(mConn, "SELECT key FROM data"));
 }
@@ -287,6 +346,58 @@ void KVStore::remove(const std::string& key)
     transaction.commit();
 }
 
+size_t KVStore::replace(const std::string& key, const std::map<std::string, std::string>& values)
+{
+    Transaction transaction(*this);
+
+    std::map<std::string, std::string> storedValues;
+    {
+        ScopedReset scopedReset(mGetValuesStmt);
+        ::sqlite3_bind_text(mGetValuesStmt->get(), 1, key.c_str(), AUTO_DETERM_SIZE, SQLITE_STATIC);
+        for (;;) {
+            int ret = ::sqlite3_step(mGetValuesStmt->get());
+            if (ret == SQLITE_DONE) {
+                break;
+            }
+            if (ret != SQLITE_ROW) {
+                throw CargoException("Error during stepping: " + mConn.getErrorMessage());
+            }
+            const char* storedKey = reinterpret_cast<const char*>(sqlite3_column_text(mGetValuesStmt->get(),
+                                                                                      FIRST_COLUMN));
+            storedValues.emplace(storedKey, getColumnValue(*mGetValuesStmt, FIRST_COLUMN + 1));
+        }
+    }
+
+    size_t changes = 0;
+    for (const auto& storedValue : storedValues) {
+        if (values.count(storedValue.first) == 0) {
+            ScopedReset scopedReset(mRemoveValueStmt);
+            ::sqlite3_bind_text(mRemoveValueStmt->get(), 1, storedValue.first.c_str(), AUTO_DETERM_SIZE, SQLITE_STATIC);
+            if (::sqlite3_step(mRemoveValueStmt->get()) != SQLITE_DONE) {
+                throw CargoException("Error during stepping: " + mConn.getErrorMessage());
+            }
+            ++changes;
+        }
+    }
+
+    for (const auto& value : values) {
+        const auto it = storedValues.find(value.first);
+        if (it == storedValues.end() || it->second != value.second) {
+            set(value.first, value.second);
+            ++changes;
+        }
+    }
+
+    transaction.commit();
+    return changes;
+}
+
+void KVStore::setCompressionThreshold(const size_t threshold)
+{
+    Lock lock(mMutex);
+    mCompressionThreshold = threshold;
+}
+
 std::vector<std::string> KVStore::getKeys()
 {
     Transaction transaction(*this);
@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -105,6 +106,17 @@ public:
      */
     void remove(const std::string& key);
 
+    /**
+     * Replaces the values corresponding to the passed key with the passed values.
+     * Only the values that differ from the stored ones are written
+     * and only the keys missing in the passed values are removed.
+     *
+     * @param key string key of the replaced values, as in remove()
+     * @param values new values of the key and of the keys starting with key + '.'
+     * @return number of written and removed values
+     */
+    size_t replace(const std::string& key, const std::map<std::string, std::string>& values);
+
     /**
      * Stores a single value corresponding to the passed key
      *
@@ -126,12 +138,21 @@ public:
      */
     std::vector<std::string> getKeys();
 
+    /**
+     * Values at least threshold bytes long are stored compressed, if they get smaller.
+     * Compressed values are stored as BLOBs and get() decompresses them.
+     *
+     * @param threshold size of the smallest compressed value, 0 disables the compression
+     */
+    void setCompressionThreshold(const size_t threshold);
+
 private:
     typedef std::lock_guard<std::recursive_mutex> Lock;
 
     std::recursive_mutex mMutex;
     size_t mTransactionDepth;
     bool mIsTransactionCommited;
+    size_t mCompressionThreshold;
 
     std::string mPath;
     sqlite3::Connection mConn;
@@ -142,6 +163,8 @@ private:
     std::unique_ptr<sqlite3::Statement> mGetValueListStmt;
     std::unique_ptr<sqlite3::Statement> mSetValueStmt;
     std::unique_ptr<sqlite3::Statement> mRemoveValuesStmt;
+    std::unique_ptr<sqlite3::Statement> mRemoveValueStmt;
+    std::unique_ptr<sqlite3::Statement> mGetValuesStmt;
     std::unique_ptr<sqlite3::Statement> mGetKeysStmt;
 
     void setupDb();
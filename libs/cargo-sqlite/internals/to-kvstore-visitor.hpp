@@ -44,14 +44,25 @@ class ToKVStoreVisitor {
 public:
     ToKVStoreVisitor(KVStore& store, const std::string& prefix)
         : mStore(store),
-          mKeyPrefix(prefix)
+          mKeyPrefix(prefix),
+          mValues(nullptr)
+    {
+    }
+
+    /**
+     * Collects the values in the map instead of storing them, e.g. for KVStore::replace()
+     */
+    ToKVStoreVisitor(KVStore& store, const std::string& prefix, std::map<std::string, std::string>& values)
+        : mStore(store),
+          mKeyPrefix(prefix),
+          mValues(&values)
     {
     }
 
     ToKVStoreVisitor& operator=(const ToKVStoreVisitor&) = delete;
 
     template<typename T>
-    void visit(const std::string& name, const T& value)
+    void visit(const FieldName& name, const T& value)
     {
         setInternal(key(mKeyPrefix, name), value);
     }
@@ -59,17 +70,31 @@ public:
 private:
     KVStore& mStore;
     std::string mKeyPrefix;
+    std::map<std::string, std::string>* mValues;
 
     ToKVStoreVisitor(const ToKVStoreVisitor& visitor, const std::string& prefix)
         : mStore(visitor.mStore),
-          mKeyPrefix(prefix)
+          mKeyPrefix(prefix),
+          mValues(visitor.mValues)
     {
     }
 
     template<typename T, typename std::enable_if<isStreamableOut<T>::value, int>::type = 0>
     void setInternal(const std::string& name, const T& value)
     {
-        mStore.set(name, toString(value));
+        if (mValues) {
+            (*mValues)[name] = toString(value);
+        } else {
+            mStore.set(name, toString(value));
+        }
+    }
+
+    void removeInternal(const std::string& name)
+    {
+        // Collected values never contain the old elements of the ranges
+        if (!mValues) {
+            mStore.remove(name);
+        }
     }
 
     template<typename T, typename std::enable_if<isVisitable<T>::value, int>::type = 0>
@@ -92,7 +117,7 @@ private:
                           const size_t size) {
         KVStore::Transaction transaction(mStore);
 
-        mStore.remove(name);
+        removeInternal(name);
         setInternal(name, size);
         size_t i = 0;
         for (auto it = begin; it != end; ++it) {
@@ -118,7 +143,7 @@ private:
     void setInternal(const std::string& name, const std::map<std::string, V>& values) {
         KVStore::Transaction transaction(mStore);
 
-        mStore.remove(name);
+        removeInternal(name);
         setInternal(name, values.size());
         size_t i = 0;
         for (const auto& it : values) {
@@ -157,7 +182,7 @@ private:
         template<typename T>
         void visit(T& value)
         {
-            mVisitor.visit(std::to_string(idx), value);
+            mVisitor.setInternal(key(mVisitor.mKeyPrefix, idx), value);
             ++idx;
         }
 
@@ -26,6 +26,7 @@
 #define CARGO_VALIDATOR_INTERNALS_VALIDATOR_VISITOR_HPP
 
 #include "cargo-validator/exception.hpp"
+#include "cargo/field-name.hpp"
 #include "cargo/internals/visit-fields.hpp"
 
 #include <string>
@@ -40,13 +41,13 @@ public:
 
     template<typename T, typename Fn>
     void visit(const Fn &func,
-               const std::string &field_name,
+               const FieldName &field_name,
                const T& value)
     {
         try {
             if (!func(value)) {
                 const std::string msg = "validation failed on field: " +
-                                        field_name +
+                                        field_name.str() +
                                         "(" + std::string(typeid(value).name()) + ")";
                 throw VerificationException(msg);
             }
@@ -57,14 +58,14 @@ public:
 
     template<typename A, typename B, typename Fn>
     void visit(const Fn &func,
-               const std::string &field_A_name,
+               const FieldName &field_A_name,
                const A& arg_A,
-               const std::string &field_B_name,
+               const FieldName &field_B_name,
                const B& arg_B)
     {
         if (!func(arg_A, arg_B)) {
             const std::string msg = "validation failed: improper fields " +
-                                    field_A_name + " and " + field_B_name +
+                                    field_A_name.str() + " and " + field_B_name.str() +
                                     " relationship.";
             throw VerificationException(msg);
         }
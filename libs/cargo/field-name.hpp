@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author Jan Olszak (j.olszak@samsung.com)
+ * @brief  Descriptor of a registered field passed to the visitors
+ */
+
+#ifndef CARGO_FIELD_NAME_HPP
+#define CARGO_FIELD_NAME_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace cargo {
+
+/**
+ * Name of a field, created from a string literal, so it doesn't own or copy the text.
+ * Names generated by CARGO_REGISTER are constant expressions, together with the hash.
+ */
+class FieldName {
+public:
+    /**
+     * @param name   string literal
+     * @param index  position of the field in its CARGO_REGISTER
+     */
+    template<std::size_t N>
+    constexpr FieldName(const char (&name)[N], const std::size_t index = 0)
+        : mName(name),
+          mSize(N - 1),
+          mIndex(index),
+          mHash(hash(name, N - 1))
+    {
+    }
+
+    /**
+     * @return null terminated name
+     */
+    constexpr const char* c_str() const
+    {
+        return mName;
+    }
+
+    constexpr const char* data() const
+    {
+        return mName;
+    }
+
+    constexpr std::size_t size() const
+    {
+        return mSize;
+    }
+
+    constexpr std::size_t index() const
+    {
+        return mIndex;
+    }
+
+    constexpr std::uint32_t hash() const
+    {
+        return mHash;
+    }
+
+    std::string str() const
+    {
+        return std::string(mName, mSize);
+    }
+
+    /**
+     * Keeps visitors written for the std::string names working
+     */
+    operator std::string() const
+    {
+        return str();
+    }
+
+    bool equals(const char* data, const std::size_t size) const
+    {
+        return size == mSize && std::memcmp(data, mName, size) == 0;
+    }
+
+    /**
+     * 32 bit FNV-1a
+     */
+    static constexpr std::uint32_t hash(const char* data,
+                                        const std::size_t size,
+                                        const std::uint32_t seed = 2166136261u)
+    {
+        return size == 0 ? seed : hash(data + 1,
+                                       size - 1,
+                                       (seed ^ static_cast<unsigned char>(*data)) * 16777619u);
+    }
+
+private:
+    const char* mName;
+    std::size_t mSize;
+    std::size_t mIndex;
+    std::uint32_t mHash;
+};
+
+inline bool operator==(const FieldName& name, const std::string& other)
+{
+    return name.equals(other.data(), other.size());
+}
+
+inline bool operator==(const std::string& other, const FieldName& name)
+{
+    return name.equals(other.data(), other.size());
+}
+
+inline bool operator!=(const FieldName& name, const std::string& other)
+{
+    return !(name == other);
+}
+
+inline bool operator!=(const std::string& other, const FieldName& name)
+{
+    return !(name == other);
+}
+
+inline std::ostream& operator<<(std::ostream& out, const FieldName& name)
+{
+    return out.write(name.data(), name.size());
+}
+
+} // namespace cargo
+
+#endif // CARGO_FIELD_NAME_HPP
@@ -0,0 +1,216 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author Jan Olszak (j.olszak@samsung.com)
+ * @brief  Table of the fields registered in a class, with a perfect hash of their names
+ */
+
+#ifndef CARGO_FIELD_TABLE_HPP
+#define CARGO_FIELD_TABLE_HPP
+
+#include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cargo {
+
+/**
+ * Fields of a class registered with CARGO_REGISTER or CARGO_EXTEND, in the order of visiting.
+ * Finds the index of a field by its name in constant time, so a loader can visit
+ * the fields in the order they come in the input.
+ *
+ * The perfect hash is built with the hash and displace method, once per class.
+ */
+class FieldTable {
+public:
+    /**
+     * @param fields  names generated by CARGO_REGISTER
+     * @param size    number of the fields
+     */
+    FieldTable(const FieldName* fields, const std::size_t size)
+        : mFields(fields, fields + size)
+    {
+        build();
+    }
+
+    /**
+     * Fields of the base class follow the fields of the extending class,
+     * as CARGO_EXTEND visits them.
+     *
+     * @param fields  names generated by CARGO_EXTEND
+     * @param size    number of the fields
+     * @param parent  table of the base class
+     */
+    FieldTable(const FieldName* fields, const std::size_t size, const FieldTable& parent)
+        : mFields(fields, fields + size)
+    {
+        mFields.insert(mFields.end(), parent.mFields.begin(), parent.mFields.end());
+        build();
+    }
+
+    FieldTable(const FieldTable&) = delete;
+    FieldTable& operator=(const FieldTable&) = delete;
+
+    std::size_t size() const
+    {
+        return mFields.size();
+    }
+
+    const FieldName& operator[](const std::size_t index) const
+    {
+        return mFields[index];
+    }
+
+    /**
+     * @return index of the field, size() if there's no field with this name.
+     *         A field of the extending class hides the base class field with the same name.
+     */
+    std::size_t find(const char* name, const std::size_t size) const
+    {
+        if (mFields.empty()) {
+            return 0;
+        }
+        const std::uint32_t nameHash = hash(name, size);
+        const std::size_t index = mSlots[getSlot(nameHash, mDisplacements[nameHash % mDisplacements.size()])];
+        return mFields[index].equals(name, size) ? index : mFields.size();
+    }
+
+    std::size_t find(const std::string& name) const
+    {
+        return find(name.data(), name.size());
+    }
+
+private:
+    std::vector<FieldName> mFields;
+    // Displacement of each bucket
+    std::vector<std::uint32_t> mDisplacements;
+    // Field index in each slot
+    std::vector<std::size_t> mSlots;
+
+    /**
+     * The same as FieldName::hash, without recursion, for names of any length
+     */
+    static std::uint32_t hash(const char* data, const std::size_t size)
+    {
+        std::uint32_t value = 2166136261u;
+        for (std::size_t i = 0; i < size; ++i) {
+            value = (value ^ static_cast<unsigned char>(data[i])) * 16777619u;
+        }
+        return value;
+    }
+
+    std::size_t getSlot(const std::uint32_t nameHash, const std::uint32_t displacement) const
+    {
+        std::uint32_t value = nameHash ^ (displacement * 0x9e3779b9u);
+        value ^= value >> 16;
+        value *= 0x85ebca6bu;
+        value ^= value >> 13;
+        value *= 0xc2b2ae35u;
+        value ^= value >> 16;
+        return value % mSlots.size();
+    }
+
+    void build()
+    {
+        if (mFields.empty()) {
+            return;
+        }
+
+        // Buckets of fields with the same hash modulo the number of buckets.
+        // Only the first field with a given name is reachable.
+        std::vector<std::vector<std::size_t>> buckets(mFields.size());
+        for (std::size_t i = 0; i < mFields.size(); ++i) {
+            bool isHidden = false;
+            for (std::size_t j = 0; j < i && !isHidden; ++j) {
+                isHidden = mFields[j].equals(mFields[i].data(), mFields[i].size());
+            }
+            if (!isHidden) {
+                buckets[mFields[i].hash() % buckets.size()].push_back(i);
+            }
+        }
+
+        // Place the biggest buckets first, while most of the slots are free
+        std::vector<std::size_t> order(buckets.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](std::size_t a, std::size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        const std::uint32_t MAX_DISPLACEMENT = 1 << 16;
+        for (std::size_t slotsCount = mFields.size(); slotsCount <= 8 * mFields.size(); slotsCount *= 2) {
+            mSlots.assign(slotsCount, mFields.size());
+            mDisplacements.assign(buckets.size(), 0);
+            if (placeBuckets(buckets, order, MAX_DISPLACEMENT)) {
+                // Empty slots point to the first field, find() compares the names anyway
+                std::replace(mSlots.begin(), mSlots.end(), mFields.size(), std::size_t(0));
+                return;
+            }
+        }
+        throw CargoException("Can't build the field table, field names have the same hash");
+    }
+
+    bool placeBuckets(const std::vector<std::vector<std::size_t>>& buckets,
+                      const std::vector<std::size_t>& order,
+                      const std::uint32_t maxDisplacement)
+    {
+        std::vector<std::size_t> taken;
+        for (const std::size_t bucket : order) {
+            if (buckets[bucket].empty()) {
+                break;
+            }
+
+            bool isPlaced = false;
+            for (std::uint32_t displacement = 0; displacement < maxDisplacement && !isPlaced; ++displacement) {
+                taken.clear();
+                isPlaced = true;
+                for (const std::size_t field : buckets[bucket]) {
+                    const std::size_t slot = getSlot(mFields[field].hash(), displacement);
+                    if (mSlots[slot] != mFields.size()) {
+                        isPlaced = false;
+                        break;
+                    }
+                    mSlots[slot] = field;
+                    taken.push_back(slot);
+                }
+                if (!isPlaced) {
+                    for (const std::size_t slot : taken) {
+                        mSlots[slot] = mFields.size();
+                    }
+                } else {
+                    mDisplacements[bucket] = displacement;
+                }
+            }
+            if (!isPlaced) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace cargo
+
+#endif // CARGO_FIELD_TABLE_HPP
@@ -27,22 +27,12 @@
 
 #include "cargo/fields.hpp"
 #include "cargo/exception.hpp"
+#include "cargo/internals/is-union.hpp"
+#include "cargo/internals/union-storage.hpp"
 
-#include <utility>
-#include <boost/any.hpp>
-
-class DisableMoveAnyWrapper : public boost::any
-{
-    public:
-        DisableMoveAnyWrapper() {}
-        DisableMoveAnyWrapper(const DisableMoveAnyWrapper& any)
-            : boost::any(static_cast<const boost::any&>(any)) {};
-        DisableMoveAnyWrapper& operator=(DisableMoveAnyWrapper&& any) = delete;
-        DisableMoveAnyWrapper& operator=(const DisableMoveAnyWrapper& any) {
-            static_cast<boost::any&>(*this) = static_cast<const boost::any&>(any);
-            return *this;
-        }
-};
+#include <cstdint>
+#include <string>
+#include <type_traits>
 
 /**
  * @ingroup libCargo
@@ -103,98 +93,136 @@ class DisableMoveAnyWrapper : public boost::any
  *     config.set(Foo({"some string"}));
  *   }
  * @endcode
+ *
+ * The option is stored in place, the type is saved as its name.
+ * Setting a type that isn't an option doesn't compile.
+ * Visitors with the UNION_INDEX constant set to true (see usesUnionIndex)
+ * get the position of the type in CARGO_DECLARE_UNION as std::uint8_t instead.
  */
 #define CARGO_DECLARE_UNION(...)                                                                \
 private:                                                                                        \
-    DisableMoveAnyWrapper mCargoDeclareField;                                                   \
+    typedef ::cargo::internals::UnionStorage<__VA_ARGS__> UnionStorage;                         \
+    UnionStorage mCargoDeclareField;                                                            \
                                                                                                 \
+    static const ::cargo::FieldTable& getOptionTable() {                                        \
+        static constexpr ::cargo::FieldName names[] = {                                         \
+            GENERATE_CODE(GENERATE_UNION_OPTION_NAME__, __VA_ARGS__)                            \
+        };                                                                                      \
+        static const ::cargo::FieldTable table(names, BOOST_PP_VARIADIC_SIZE(__VA_ARGS__));     \
+        return table;                                                                           \
+    }                                                                                           \
+    static const std::string& getOptionName(const std::size_t index) {                          \
+        static const std::string names[] = {                                                    \
+            GENERATE_CODE(GENERATE_UNION_NAME__, __VA_ARGS__)                                   \
+        };                                                                                      \
+        return names[index];                                                                    \
+    }                                                                                           \
     template<typename Visitor>                                                                  \
-    void visitOption(Visitor& v, const std::string& name) {                                     \
+    void visitOption(Visitor& v, const std::size_t index) {                                     \
+        if (index >= BOOST_PP_VARIADIC_SIZE(__VA_ARGS__)) {                                     \
+            throw cargo::CargoException("Union type error. Unsupported type");                  \
+        }                                                                                       \
+        mCargoDeclareField.emplaceIndex(index + 1);                                             \
+        switch (index) {                                                                        \
         GENERATE_CODE(GENERATE_UNION_VISIT__, __VA_ARGS__)                                      \
-        throw cargo::CargoException("Union type error. Unsupported type");                      \
+        }                                                                                       \
     }                                                                                           \
     template<typename Visitor>                                                                  \
-    void visitOption(Visitor& v, const std::string& name) const {                               \
+    void visitOption(Visitor& v, const std::size_t index) const {                               \
+        switch (index) {                                                                        \
         GENERATE_CODE(GENERATE_UNION_VISIT_CONST__, __VA_ARGS__)                                \
-        throw cargo::CargoException("Union type error. Unsupported type");                      \
+        }                                                                                       \
+    }                                                                                           \
+    template<typename Visitor>                                                                  \
+    void visitType(Visitor& v, std::false_type) {                                               \
+        std::string name;                                                                       \
+        v.visit(::cargo::FieldName("type", 0), name);                                           \
+        visitOption(v, getOptionTable().find(name));                                            \
     }                                                                                           \
-    std::string getOptionName() const {                                                         \
-        GENERATE_CODE(GENERATE_UNION_NAME__, __VA_ARGS__)                                       \
-        return std::string();                                                                   \
+    template<typename Visitor>                                                                  \
+    void visitType(Visitor& v, std::true_type) {                                                \
+        std::uint8_t index = 0;                                                                 \
+        v.visit(::cargo::FieldName("type", 0), index);                                          \
+        visitOption(v, index);                                                                  \
     }                                                                                           \
-    boost::any& getHolder() {                                                                   \
-        return static_cast<boost::any&>(mCargoDeclareField);                                    \
+    template<typename Visitor>                                                                  \
+    void visitType(Visitor& v, std::false_type) const {                                         \
+        const std::size_t index = mCargoDeclareField.index() - 1;                               \
+        v.visit(::cargo::FieldName("type", 0), getOptionName(index));                           \
+        visitOption(v, index);                                                                  \
     }                                                                                           \
-    const boost::any& getHolder() const {                                                       \
-        return static_cast<const boost::any&>(mCargoDeclareField);                              \
+    template<typename Visitor>                                                                  \
+    void visitType(Visitor& v, std::true_type) const {                                          \
+        const std::uint8_t index = static_cast<std::uint8_t>(mCargoDeclareField.index() - 1);   \
+        v.visit(::cargo::FieldName("type", 0), index);                                          \
+        visitOption(v, index);                                                                  \
     }                                                                                           \
 public:                                                                                         \
                                                                                                 \
     template<typename Visitor>                                                                  \
     void accept(Visitor v) {                                                                    \
-        std::string name;                                                                       \
-        v.visit("type", name);                                                                  \
-        visitOption(v, name);                                                                   \
+        visitType(v, ::cargo::internals::usesUnionIndex<Visitor>());                            \
     }                                                                                           \
                                                                                                 \
     template<typename Visitor>                                                                  \
     void accept(Visitor v) const {                                                              \
-        const std::string name = getOptionName();                                               \
-        if (name.empty()) {                                                                     \
+        if (mCargoDeclareField.index() == 0) {                                                  \
            throw cargo::CargoException("Type is not set");                                      \
         }                                                                                       \
-        v.visit("type", name);                                                                  \
-        visitOption(v, name);                                                                   \
+        visitType(v, ::cargo::internals::usesUnionIndex<Visitor>());                            \
     }                                                                                           \
                                                                                                 \
     template<typename Type>                                                                     \
     bool is() const {                                                                           \
-        return boost::any_cast<Type>(&getHolder()) != NULL;                                     \
+        return mCargoDeclareField.template is<Type>();                                          \
     }                                                                                           \
     template<typename Type>                                                                     \
     typename std::enable_if<!std::is_const<Type>::value, Type>::type& as() {                    \
-        if (getHolder().empty()) {                                                              \
+        if (mCargoDeclareField.index() == 0) {                                                  \
             throw cargo::CargoException("Type is not set");                                     \
         }                                                                                       \
-        return boost::any_cast<Type&>(getHolder());                                             \
+        if (!is<Type>()) {                                                                      \
+            throw cargo::CargoException("Union type error. Other type is set");                 \
+        }                                                                                       \
+        return mCargoDeclareField.template get<Type>();                                         \
     }                                                                                           \
     template<typename Type>                                                                     \
     const Type& as() const {                                                                    \
-        if (getHolder().empty()) {                                                              \
+        if (mCargoDeclareField.index() == 0) {                                                  \
             throw cargo::CargoException("Type is not set");                                     \
         }                                                                                       \
-        return boost::any_cast<const Type&>(getHolder());                                       \
+        if (!is<Type>()) {                                                                      \
+            throw cargo::CargoException("Union type error. Other type is set");                 \
+        }                                                                                       \
+        return mCargoDeclareField.template get<Type>();                                         \
     }                                                                                           \
     bool isSet() {                                                                              \
-        return !getOptionName().empty();                                                        \
+        return mCargoDeclareField.index() != 0;                                                 \
     }                                                                                           \
     template<typename Type>                                                                     \
     Type& set(const Type& src) {                                                                \
-        getHolder() = std::forward<const Type>(src);                                            \
-        if (getOptionName().empty()) {                                                          \
-           throw cargo::CargoException("Unsupported type");                                     \
-        }                                                                                       \
-        return as<Type>();                                                                      \
+        static_assert(UnionStorage::template indexOf<Type>() != 0,                              \
+                      "Type is not an option of the union");                                    \
+        return mCargoDeclareField.emplace(src);                                                 \
     }                                                                                           \
 
 #define GENERATE_CODE(MACRO, ...)                                                               \
-    BOOST_PP_LIST_FOR_EACH(MACRO, _, BOOST_PP_VARIADIC_TO_LIST(__VA_ARGS__))
+    BOOST_PP_LIST_FOR_EACH_I(MACRO, _, BOOST_PP_VARIADIC_TO_LIST(__VA_ARGS__))
+
+#define GENERATE_UNION_OPTION_NAME__(r, _, i, TYPE_)                                            \
+    ::cargo::FieldName(BOOST_PP_STRINGIZE(TYPE_), i),
 
-#define GENERATE_UNION_VISIT__(r, _, TYPE_)                                                     \
-    if (#TYPE_ == name) {                                                                       \
-        v.visit("value", set(std::move(TYPE_())));                                              \
-        return;                                                                                 \
-    }
+#define GENERATE_UNION_NAME__(r, _, i, TYPE_)                                                   \
+    BOOST_PP_STRINGIZE(TYPE_),
 
-#define GENERATE_UNION_VISIT_CONST__(r, _, TYPE_)                                               \
-    if (#TYPE_ == name) {                                                                       \
-        v.visit("value", as<const TYPE_>());                                                    \
-        return;                                                                                 \
-    }
+#define GENERATE_UNION_VISIT__(r, _, i, TYPE_)                                                  \
+    case i:                                                                                     \
+        v.visit(::cargo::FieldName("value", 1), as<TYPE_>());                                   \
+        break;
 
-#define GENERATE_UNION_NAME__(r, _, TYPE_)                                                      \
-    if (is<TYPE_>()) {                                                                          \
-        return #TYPE_;                                                                          \
-    }
+#define GENERATE_UNION_VISIT_CONST__(r, _, i, TYPE_)                                            \
+    case i:                                                                                     \
+        v.visit(::cargo::FieldName("value", 1), as<const TYPE_>());                             \
+        break;
 
 #endif // CARGO_FIELDS_UNION_HPP
@@ -28,9 +28,16 @@
 
 #include <boost/preprocessor/variadic/to_list.hpp>
 #include <boost/preprocessor/list/for_each.hpp>
+#include <boost/preprocessor/list/for_each_i.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/variadic/size.hpp>
 
+#include "cargo/field-name.hpp"
+#include "cargo/field-table.hpp"
 #include "cargo/types.hpp"
 
+#include <cstddef>
+
 #if BOOST_PP_VARIADICS != 1
 #error variadic macros not supported
 #endif
@@ -43,6 +50,16 @@
     template<typename Visitor>                                     \
     static void accept(Visitor ) {                                 \
     }                                                              \
+    template<typename Visitor>                                     \
+    static void acceptField(const std::size_t, Visitor ) {         \
+    }                                                              \
+    static constexpr std::size_t getFieldCount() {                 \
+        return 0;                                                  \
+    }                                                              \
+    static const ::cargo::FieldTable& getFieldTable() {            \
+        static const ::cargo::FieldTable table(nullptr, 0);        \
+        return table;                                              \
+    }                                                              \
 
 /**
  * @ingroup libcargo
@@ -70,6 +87,11 @@
  *       )
  *   };
  * @endcode
+ *
+ * Besides accept() it generates:
+ *  - getFieldCount(), number of the fields, a constant expression
+ *  - getFieldTable(), names of the fields with a perfect hash, see cargo::FieldTable
+ *  - acceptField(index, visitor), visits one field, the index comes from the table
  */
 #define CARGO_REGISTER(...)                                        \
     template<typename Visitor>                                     \
@@ -80,6 +102,29 @@
     void accept(Visitor v) const {                                 \
         GENERATE_ELEMENTS__(__VA_ARGS__)                           \
     }                                                              \
+    template<typename Visitor>                                     \
+    void acceptField(const std::size_t index, Visitor v) {         \
+        switch (index) {                                           \
+        GENERATE_FIELD_CASES__(__VA_ARGS__)                        \
+        }                                                          \
+    }                                                              \
+    template<typename Visitor>                                     \
+    void acceptField(const std::size_t index, Visitor v) const {   \
+        switch (index) {                                           \
+        GENERATE_FIELD_CASES__(__VA_ARGS__)                        \
+        }                                                          \
+    }                                                              \
+    static constexpr std::size_t getFieldCount() {                 \
+        return BOOST_PP_VARIADIC_SIZE(__VA_ARGS__);                \
+    }                                                              \
+    static const ::cargo::FieldTable& getFieldTable() {            \
+        static constexpr ::cargo::FieldName names[] = {            \
+            GENERATE_FIELD_NAMES__(__VA_ARGS__)                    \
+        };                                                         \
+        static const ::cargo::FieldTable table(names,              \
+                                               getFieldCount());   \
+        return table;                                              \
+    }                                                              \
 
 /**
  * @ingroup libcargo
@@ -137,13 +182,67 @@
         GENERATE_ELEMENTS__(__VA_ARGS__)                           \
         ParentVisitor::accept(v);                                  \
     }                                                              \
+    template<typename Visitor>                                     \
+    void acceptField(const std::size_t index, Visitor v) {         \
+        switch (index) {                                           \
+        GENERATE_FIELD_CASES__(__VA_ARGS__)                        \
+        default:                                                   \
+            ParentVisitor::acceptField(                            \
+                index - BOOST_PP_VARIADIC_SIZE(__VA_ARGS__), v);   \
+        }                                                          \
+    }                                                              \
+    template<typename Visitor>                                     \
+    void acceptField(const std::size_t index, Visitor v) const {   \
+        switch (index) {                                           \
+        GENERATE_FIELD_CASES__(__VA_ARGS__)                        \
+        default:                                                   \
+            ParentVisitor::acceptField(                            \
+                index - BOOST_PP_VARIADIC_SIZE(__VA_ARGS__), v);   \
+        }                                                          \
+    }                                                              \
+    static constexpr std::size_t getFieldCount() {                 \
+        return BOOST_PP_VARIADIC_SIZE(__VA_ARGS__) +               \
+               ParentVisitor::getFieldCount();                     \
+    }                                                              \
+    static const ::cargo::FieldTable& getFieldTable() {            \
+        static constexpr ::cargo::FieldName names[] = {            \
+            GENERATE_FIELD_NAMES__(__VA_ARGS__)                    \
+        };                                                         \
+        static const ::cargo::FieldTable table(                    \
+            names,                                                 \
+            BOOST_PP_VARIADIC_SIZE(__VA_ARGS__),                   \
+            ParentVisitor::getFieldTable());                       \
+        return table;                                              \
+    }                                                              \
 
 #define GENERATE_ELEMENTS__(...)                                   \
-    BOOST_PP_LIST_FOR_EACH(GENERATE_ELEMENT__,                     \
-                           _,                                      \
-                           BOOST_PP_VARIADIC_TO_LIST(__VA_ARGS__)) \
+    BOOST_PP_LIST_FOR_EACH_I(GENERATE_ELEMENT__,                   \
+                             _,                                    \
+                             BOOST_PP_VARIADIC_TO_LIST(__VA_ARGS__)) \
+
+#define GENERATE_ELEMENT__(r, _, i, element)                       \
+    {                                                              \
+        constexpr ::cargo::FieldName name__(                       \
+            BOOST_PP_STRINGIZE(element), i);                       \
+        v.visit(name__, element);                                  \
+    }                                                              \
+
+#define GENERATE_FIELD_CASES__(...)                                \
+    BOOST_PP_LIST_FOR_EACH_I(GENERATE_FIELD_CASE__,                \
+                             _,                                    \
+                             BOOST_PP_VARIADIC_TO_LIST(__VA_ARGS__)) \
+
+#define GENERATE_FIELD_CASE__(r, _, i, element)                    \
+    case i:                                                        \
+        GENERATE_ELEMENT__(r, _, i, element)                       \
+        break;                                                     \
+
+#define GENERATE_FIELD_NAMES__(...)                                \
+    BOOST_PP_LIST_FOR_EACH_I(GENERATE_FIELD_NAME__,                \
+                             _,                                    \
+                             BOOST_PP_VARIADIC_TO_LIST(__VA_ARGS__)) \
 
-#define GENERATE_ELEMENT__(r, _, element)                          \
-    v.visit(#element, element);                                    \
+#define GENERATE_FIELD_NAME__(r, _, i, element)                    \
+    ::cargo::FieldName(BOOST_PP_STRINGIZE(element), i),            \
 
 #endif // CARGO_FIELDS_HPP
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Visiting one field of a structure selected by its path
+ */
+
+#ifndef CARGO_INTERNALS_FIELD_PATH_HPP
+#define CARGO_INTERNALS_FIELD_PATH_HPP
+
+#include "cargo/exception.hpp"
+#include "cargo/field-name.hpp"
+#include "cargo/field-table.hpp"
+#include "cargo/internals/has-field-table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Follows the path through the field tables, one name at a time
+ */
+template<typename PathVisitor>
+class FieldPathVisitor {
+public:
+    FieldPathVisitor(PathVisitor& visitor, const std::string& path, const std::size_t nameBegin)
+        : mVisitor(&visitor),
+          mPath(&path),
+          mNameBegin(nameBegin),
+          mNameEnd(std::min(path.find('.', nameBegin), path.size()))
+    {
+    }
+
+    template<typename T, typename std::enable_if<hasFieldTable<T>::value, int>::type = 0>
+    void enter(T& visitable)
+    {
+        const FieldTable& table = T::getFieldTable();
+        const std::size_t index = table.find(mPath->data() + mNameBegin, mNameEnd - mNameBegin);
+        if (index == table.size()) {
+            throw CargoException("No field '" + mPath->substr(0, mNameEnd) + "'");
+        }
+        visitable.acceptField(index, *this);
+    }
+
+    template<typename T, typename std::enable_if<!hasFieldTable<T>::value, int>::type = 0>
+    void enter(T&)
+    {
+        throw CargoException("Field '" + getParentPath() + "' has no registered fields");
+    }
+
+    template<typename T>
+    void visit(const FieldName& name, T& value)
+    {
+        if (mNameEnd == mPath->size()) {
+            mVisitor->visitPath(getParentPath(), name, value);
+        } else {
+            FieldPathVisitor next(*mVisitor, *mPath, mNameEnd + 1);
+            next.enter(value);
+        }
+    }
+
+private:
+    PathVisitor* mVisitor;
+    const std::string* mPath;
+    std::size_t mNameBegin;
+    std::size_t mNameEnd;
+
+    std::string getParentPath() const
+    {
+        return mNameBegin == 0 ? std::string() : mPath->substr(0, mNameBegin - 1);
+    }
+};
+
+/**
+ * Visits only the field at the path, e.g. "network.mtu" is the field mtu of the field network.
+ * Structures on the path have to be registered with CARGO_REGISTER or CARGO_EXTEND.
+ *
+ * @param visitable structure with the field
+ * @param path      names of the fields separated by dots
+ * @param visitor   visitor.visitPath(parentPath, name, field) is called for the field,
+ *                  parentPath is the path without the last name
+ */
+template<typename T, typename PathVisitor>
+void visitFieldPath(T& visitable, const std::string& path, PathVisitor& visitor)
+{
+    FieldPathVisitor<PathVisitor> pathVisitor(visitor, path, 0);
+    pathVisitor.enter(visitable);
+}
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_INTERNALS_FIELD_PATH_HPP
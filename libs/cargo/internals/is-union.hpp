@@ -52,7 +52,7 @@ struct check_union : isVisitable<X> {
     template <typename T,
          //list of function union must implement
          const X& (T::*)() const = &T::as,
-         X& (T::*)(const X& src) = &T::set,
+         // set() isn't checked, it accepts only the options
          bool (T::*)() = &T::isSet
     >
     struct checker__ {};
@@ -60,6 +60,24 @@ struct check_union : isVisitable<X> {
 template<typename T>
 struct isUnion : has_member<T, check_union<T>> {};
 
+template <typename T>
+struct usesUnionIndexHelper__ {
+    template <typename C> static std::integral_constant<bool, C::UNION_INDEX>
+    test(int);
+
+    template <typename C> static std::false_type
+    test(...);
+
+    static constexpr bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Visitors declaring static constexpr bool UNION_INDEX = true get the type of
+ * a CARGO_DECLARE_UNION as its position in the declaration instead of its name.
+ */
+template <typename T>
+struct usesUnionIndex : public std::integral_constant<bool, usesUnionIndexHelper__<T>::value> {};
+
 //Note:
 // unfortunately, above generic has_member can't be used for isVisitable
 // because Vistable need 'accept' OR 'accept const', while has_member make exect match
@@ -0,0 +1,230 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Compression in the LZ4 block format, without a dependency on liblz4
+ */
+
+#ifndef CARGO_INTERNALS_LZ4_HPP
+#define CARGO_INTERNALS_LZ4_HPP
+
+#include "cargo/exception.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace cargo {
+
+namespace internals {
+
+/**
+ * Fast compression of the data in the LZ4 block format, so blocks can also be read by liblz4.
+ * A block doesn't store the size of the data, the caller has to pass it on.
+ */
+namespace lz4 {
+
+const std::size_t MIN_MATCH = 4;
+const std::size_t LAST_LITERALS = 5;
+const std::size_t MATCH_FIND_LIMIT = 12;
+const std::size_t MAX_OFFSET = 65535;
+const unsigned int HASH_BITS = 12;
+const unsigned int LENGTH_BITS = 4;
+const std::size_t LENGTH_MASK = (1 << LENGTH_BITS) - 1;
+
+inline std::uint32_t read32(const char* data)
+{
+    std::uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline std::uint32_t hash(const std::uint32_t value)
+{
+    return (value * 2654435761U) >> (32 - HASH_BITS);
+}
+
+inline void putLength(std::string& out, std::size_t length)
+{
+    for (; length >= 255; length -= 255) {
+        out.push_back(static_cast<char>(255));
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+inline void putSequence(std::string& out,
+                        const char* literals,
+                        const std::size_t literalsSize,
+                        const std::size_t offset,
+                        const std::size_t matchSize)
+{
+    const std::size_t matchCode = matchSize - MIN_MATCH;
+    const std::size_t token = (std::min(literalsSize, LENGTH_MASK) << LENGTH_BITS) |
+                              std::min(matchCode, LENGTH_MASK);
+    out.push_back(static_cast<char>(token));
+    if (literalsSize >= LENGTH_MASK) {
+        putLength(out, literalsSize - LENGTH_MASK);
+    }
+    out.append(literals, literalsSize);
+
+    out.push_back(static_cast<char>(offset & 0xFF));
+    out.push_back(static_cast<char>(offset >> 8));
+    if (matchCode >= LENGTH_MASK) {
+        putLength(out, matchCode - LENGTH_MASK);
+    }
+}
+
+inline void putLastLiterals(std::string& out, const char* literals, const std::size_t literalsSize)
+{
+    out.push_back(static_cast<char>(std::min(literalsSize, LENGTH_MASK) << LENGTH_BITS));
+    if (literalsSize >= LENGTH_MASK) {
+        putLength(out, literalsSize - LENGTH_MASK);
+    }
+    out.append(literals, literalsSize);
+}
+
+/**
+ * Appends the compressed data to out.
+ * Data without repetitions grows by about 0.4%.
+ */
+inline void compress(const char* data, const std::size_t size, std::string& out)
+{
+    out.reserve(out.size() + size + size / 255 + 16);
+
+    std::size_t anchor = 0;
+    if (size > MATCH_FIND_LIMIT) {
+        std::vector<std::uint32_t> table(1 << HASH_BITS, 0);
+        const std::size_t findLimit = size - MATCH_FIND_LIMIT;
+        const std::size_t matchLimit = size - LAST_LITERALS;
+
+        std::size_t pos = 1;
+        while (pos < findLimit) {
+            const std::uint32_t sequence = read32(data + pos);
+            const std::uint32_t h = hash(sequence);
+            std::size_t candidate = table[h];
+            table[h] = static_cast<std::uint32_t>(pos);
+
+            if (pos - candidate > MAX_OFFSET || read32(data + candidate) != sequence) {
+                // Data without matches is skipped faster and faster
+                pos += 1 + ((pos - anchor) >> 6);
+                continue;
+            }
+
+            while (pos > anchor && candidate > 0 && data[pos - 1] == data[candidate - 1]) {
+                --pos;
+                --candidate;
+            }
+            std::size_t matchSize = MIN_MATCH;
+            while (pos + matchSize < matchLimit && data[pos + matchSize] == data[candidate + matchSize]) {
+                ++matchSize;
+            }
+
+            putSequence(out, data + anchor, pos - anchor, pos - candidate, matchSize);
+            pos += matchSize;
+            anchor = pos;
+        }
+    }
+    putLastLiterals(out, data + anchor, size - anchor);
+}
+
+inline std::size_t getLength(const char* data, const std::size_t size, std::size_t& pos)
+{
+    std::size_t length = 0;
+    unsigned char byte;
+    do {
+        if (pos >= size) {
+            throw CargoException("Compressed data is truncated");
+        }
+        byte = static_cast<unsigned char>(data[pos++]);
+        length += byte;
+    } while (byte == 255);
+    return length;
+}
+
+/**
+ * Decompresses the data to exactly outSize bytes
+ */
+inline void decompress(const char* data, const std::size_t size, char* out, const std::size_t outSize)
+{
+    std::size_t in = 0;
+    std::size_t written = 0;
+    for (;;) {
+        if (in >= size) {
+            throw CargoException("Compressed data is truncated");
+        }
+        const unsigned char token = static_cast<unsigned char>(data[in++]);
+
+        std::size_t literalsSize = token >> LENGTH_BITS;
+        if (literalsSize == LENGTH_MASK) {
+            literalsSize += getLength(data, size, in);
+        }
+        if (literalsSize > size - in || literalsSize > outSize - written) {
+            throw CargoException("Compressed data is corrupted");
+        }
+        std::memcpy(out + written, data + in, literalsSize);
+        in += literalsSize;
+        written += literalsSize;
+
+        if (in == size) {
+            break;
+        }
+
+        if (size - in < 2) {
+            throw CargoException("Compressed data is truncated");
+        }
+        const std::size_t offset = static_cast<unsigned char>(data[in]) |
+                                   static_cast<std::size_t>(static_cast<unsigned char>(data[in + 1])) << 8;
+        in += 2;
+        std::size_t matchSize = token & LENGTH_MASK;
+        if (matchSize == LENGTH_MASK) {
+            matchSize += getLength(data, size, in);
+        }
+        matchSize += MIN_MATCH;
+        if (offset == 0 || offset > written || matchSize > outSize - written) {
+            throw CargoException("Compressed data is corrupted");
+        }
+
+        const char* match = out + written - offset;
+        if (offset >= matchSize) {
+            std::memcpy(out + written, match, matchSize);
+        } else {
+            // Overlapping match repeats the last offset bytes
+            for (std::size_t i = 0; i < matchSize; ++i) {
+                out[written + i] = match[i];
+            }
+        }
+        written += matchSize;
+    }
+
+    if (written != outSize) {
+        throw CargoException("Compressed data has a wrong size");
+    }
+}
+
+} // namespace lz4
+
+} // namespace internals
+
+} // namespace cargo
+
+#endif // CARGO_INTERNALS_LZ4_HPP
@@ -0,0 +1,226 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   In-place storage of the CARGO_DECLARE_UNION options
+ */
+
+#ifndef CARGO_INTERNALS_UNION_STORAGE_HPP
+#define CARGO_INTERNALS_UNION_STORAGE_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cargo {
+namespace internals {
+
+template<typename... Types>
+struct maxSize;
+
+template<>
+struct maxSize<> : std::integral_constant<std::size_t, 1> {};
+
+template<typename T, typename... Types>
+struct maxSize<T, Types...> : std::integral_constant<std::size_t,
+    (sizeof(T) > maxSize<Types...>::value ? sizeof(T) : maxSize<Types...>::value)> {};
+
+template<typename... Types>
+struct maxAlignment;
+
+template<>
+struct maxAlignment<> : std::integral_constant<std::size_t, 1> {};
+
+template<typename T, typename... Types>
+struct maxAlignment<T, Types...> : std::integral_constant<std::size_t,
+    (alignof(T) > maxAlignment<Types...>::value ? alignof(T) : maxAlignment<Types...>::value)> {};
+
+/**
+ * Position of T in Types counted from 1, 0 if T isn't there
+ */
+template<typename T, typename... Types>
+struct optionIndex;
+
+template<typename T>
+struct optionIndex<T> : std::integral_constant<std::size_t, 0> {};
+
+template<typename T, typename U, typename... Types>
+struct optionIndex<T, U, Types...> : std::integral_constant<std::size_t,
+    std::is_same<T, U>::value ? 1 :
+    (optionIndex<T, Types...>::value == 0 ? 0 : optionIndex<T, Types...>::value + 1)> {};
+
+/**
+ * Holds one object of the Types, or nothing, in an aligned buffer.
+ * The discriminator is the position of the held type counted from 1, 0 when empty.
+ *
+ * Copies copy the held object. Moving is disabled, as it was with boost::any:
+ * rvalues are copied too.
+ */
+template<typename... Types>
+class UnionStorage {
+public:
+    static_assert(sizeof...(Types) < 256, "Too many union options");
+
+    UnionStorage()
+        : mIndex(0)
+    {
+    }
+
+    UnionStorage(const UnionStorage& other)
+        : mIndex(0)
+    {
+        copyFrom(other);
+    }
+
+    UnionStorage& operator=(const UnionStorage& other)
+    {
+        if (this != &other) {
+            reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    UnionStorage& operator=(UnionStorage&&) = delete;
+
+    ~UnionStorage()
+    {
+        reset();
+    }
+
+    /**
+     * @return position of the held type counted from 1, 0 if empty
+     */
+    std::size_t index() const
+    {
+        return mIndex;
+    }
+
+    template<typename T>
+    static constexpr std::size_t indexOf()
+    {
+        return optionIndex<typename std::remove_cv<T>::type, Types...>::value;
+    }
+
+    template<typename T>
+    bool is() const
+    {
+        return indexOf<T>() != 0 && mIndex == indexOf<T>();
+    }
+
+    /**
+     * The held object has to be a T
+     */
+    template<typename T>
+    T& get()
+    {
+        return *reinterpret_cast<T*>(&mData);
+    }
+
+    template<typename T>
+    const T& get() const
+    {
+        return *reinterpret_cast<const T*>(&mData);
+    }
+
+    /**
+     * Replaces the held object with a copy of value. T has to be one of the Types.
+     */
+    template<typename T>
+    T& emplace(const T& value)
+    {
+        typedef typename std::remove_cv<T>::type Type;
+        if (is<Type>()) {
+            // Assigning to itself is fine, the old value isn't destroyed first
+            get<Type>() = value;
+        } else {
+            Type copy(value);
+            reset();
+            new (&mData) Type(std::move(copy));
+            mIndex = static_cast<unsigned char>(indexOf<Type>());
+        }
+        return get<Type>();
+    }
+
+    /**
+     * Replaces the held object with the default constructed option at the index
+     *
+     * @param index  position of the type counted from 1
+     */
+    void emplaceIndex(const std::size_t index)
+    {
+        typedef void (*Construct)(void*);
+        static const Construct construct[] = { &constructImpl<Types>... };
+
+        reset();
+        construct[index - 1](&mData);
+        mIndex = static_cast<unsigned char>(index);
+    }
+
+    void reset()
+    {
+        typedef void (*Destroy)(void*);
+        static const Destroy destroy[] = { &destroyImpl<Types>... };
+
+        if (mIndex != 0) {
+            const std::size_t index = mIndex;
+            mIndex = 0;
+            destroy[index - 1](&mData);
+        }
+    }
+
+private:
+    typename std::aligned_storage<maxSize<Types...>::value, maxAlignment<Types...>::value>::type mData;
+    unsigned char mIndex;
+
+    void copyFrom(const UnionStorage& other)
+    {
+        typedef void (*Copy)(void*, const void*);
+        static const Copy copy[] = { &copyImpl<Types>... };
+
+        if (other.mIndex != 0) {
+            copy[other.mIndex - 1](&mData, &other.mData);
+            mIndex = other.mIndex;
+        }
+    }
+
+    template<typename T>
+    static void constructImpl(void* data)
+    {
+        new (data) T();
+    }
+
+    template<typename T>
+    static void copyImpl(void* data, const void* other)
+    {
+        new (data) T(*static_cast<const T*>(other));
+    }
+
+    template<typename T>
+    static void destroyImpl(void* data)
+    {
+        static_cast<T*>(data)->~T();
+    }
+};
+
+} // namespace internals
+} // namespace cargo
+
+#endif // CARGO_INTERNALS_UNION_STORAGE_HPP
@@ -0,0 +1,233 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Asynchronous wrapper of other logger backends
+ */
+
+#include "config.hpp"
+
+#include "logger/backend-async.hpp"
+#include "logger/formatter.hpp"
+#include "utils/signal.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <cstring>
+
+namespace logger {
+
+namespace {
+
+// Wakes up the writer even if a notification was lost
+const std::chrono::milliseconds MAX_WRITER_SLEEP(100);
+
+// How many times the crash handler tries to take over the records from the writer
+const int CRASH_TAKEOVER_TRIES = 100;
+const std::chrono::milliseconds CRASH_TAKEOVER_STEP(1);
+
+const int CRASH_SIGNALS[] = {SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL};
+
+// Backend flushed by the crash handler
+std::atomic<AsyncBackend*> gCrashBackendPtr(nullptr);
+
+} // namespace
+
+AsyncBackend::AsyncBackend(LogBackend* backendPtr,
+                           const size_t capacity,
+                           const OverflowPolicy policy)
+    : mBackendPtr(backendPtr),
+      mPolicy(policy),
+      mRecords(capacity),
+      mIsWriterSleeping(false),
+      mDroppedCount(0),
+      mIsStopping(false)
+{
+    mWriterThread = std::thread(&AsyncBackend::run, this);
+    gCrashBackendPtr.store(this);
+}
+
+AsyncBackend::~AsyncBackend()
+{
+    AsyncBackend* self = this;
+    gCrashBackendPtr.compare_exchange_strong(self, nullptr);
+
+    {
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        mIsStopping = true;
+    }
+    mWakeCondition.notify_one();
+    mWriterThread.join();
+
+    // Records logged while the writer was finishing
+    flush();
+}
+
+void AsyncBackend::log(LogLevel logLevel,
+                       const std::string& file,
+                       const unsigned int& line,
+                       const std::string& func,
+                       const std::string& message)
+{
+    Record record;
+    record.logLevel = logLevel;
+    record.file = file;
+    record.line = line;
+    record.func = func;
+    record.message = message;
+    ::gettimeofday(&record.time, nullptr);
+    record.threadId = LogFormatter::getCurrentThread();
+
+    while (!mRecords.tryPush(record)) {
+        if (mPolicy == OverflowPolicy::DROP) {
+            ++mDroppedCount;
+            return;
+        }
+        wakeWriter();
+        std::this_thread::yield();
+    }
+
+    wakeWriter();
+}
+
+void AsyncBackend::relog(LogLevel logLevel,
+                         const std::string& file,
+                         const unsigned int& line,
+                         const std::string& func,
+                         const std::istream& stream)
+{
+    std::unique_lock<std::mutex> lock(mConsumerMutex);
+    writeAll();
+    mBackendPtr->relog(logLevel, file, line, func, stream);
+}
+
+void AsyncBackend::flush()
+{
+    std::unique_lock<std::mutex> lock(mConsumerMutex);
+    writeAll();
+    mBackendPtr->flush();
+}
+
+bool AsyncBackend::isThreadSafe() const
+{
+    return true;
+}
+
+unsigned long long AsyncBackend::getDroppedCount() const
+{
+    return mDroppedCount.load();
+}
+
+void AsyncBackend::wakeWriter()
+{
+    // Pairs with the fence in run(), either the writer sees the record or we see it sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mIsWriterSleeping.load(std::memory_order_relaxed)) {
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        mWakeCondition.notify_one();
+    }
+}
+
+void AsyncBackend::run()
+{
+    for (;;) {
+        size_t written;
+        {
+            std::unique_lock<std::mutex> lock(mConsumerMutex);
+            written = writeAll();
+            if (written > 0) {
+                mBackendPtr->flush();
+            }
+        }
+        if (written > 0) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        if (mIsStopping) {
+            return;
+        }
+
+        mIsWriterSleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        bool isEmpty;
+        {
+            std::unique_lock<std::mutex> consumerLock(mConsumerMutex);
+            isEmpty = mRecords.isEmpty();
+        }
+        if (isEmpty) {
+            mWakeCondition.wait_for(lock, MAX_WRITER_SLEEP);
+        }
+
+        mIsWriterSleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+size_t AsyncBackend::writeAll()
+{
+    size_t count = 0;
+    Record record;
+    while (mRecords.tryPop(record)) {
+        LogFormatter::RecordScope scope(record.time, record.threadId);
+        try {
+            mBackendPtr->log(record.logLevel, record.file, record.line, record.func, record.message);
+        } catch (...) {
+            // There's nowhere to report it
+        }
+        ++count;
+    }
+    return count;
+}
+
+void AsyncBackend::installCrashHandler()
+{
+    struct ::sigaction sigAct;
+    ::memset(&sigAct, 0, sizeof(sigAct));
+    sigAct.sa_handler = &AsyncBackend::handleCrash;
+    sigAct.sa_flags = SA_RESETHAND;
+    ::sigemptyset(&sigAct.sa_mask);
+
+    for (const int sigNum : CRASH_SIGNALS) {
+        utils::signalSet(sigNum, &sigAct);
+    }
+}
+
+void AsyncBackend::handleCrash(int sigNum)
+{
+    AsyncBackend* backendPtr = gCrashBackendPtr.load();
+    if (backendPtr) {
+        // The crash could have happened in the writer, don't wait forever
+        for (int i = 0; i < CRASH_TAKEOVER_TRIES; ++i) {
+            if (backendPtr->mConsumerMutex.try_lock()) {
+                backendPtr->writeAll();
+                backendPtr->mBackendPtr->flush();
+                backendPtr->mConsumerMutex.unlock();
+                break;
+            }
+            std::this_thread::sleep_for(CRASH_TAKEOVER_STEP);
+        }
+    }
+
+    // SA_RESETHAND restored the default action
+    ::raise(sigNum);
+}
+
+} // namespace logger
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Asynchronous wrapper of other logger backends
+ */
+
+#ifndef LOGGER_BACKEND_ASYNC_HPP
+#define LOGGER_BACKEND_ASYNC_HPP
+
+#include "logger/backend.hpp"
+#include "logger/ring-buffer.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <sys/time.h>
+
+namespace logger {
+
+/**
+ * Moves writing the logs off the logging threads.
+ *
+ * log() only stores the record in a bounded lock-free queue,
+ * a background thread takes the records in batches and passes them to the wrapped backend.
+ * Time and thread of a record are taken when it's logged, so the headers are the same as without the wrapper.
+ *
+ * Example usage:
+ * @code
+ * Logger::setLogBackend(new AsyncBackend(new PersistentFileBackend("/tmp/logs.txt")));
+ * AsyncBackend::installCrashHandler();
+ * @endcode
+ */
+class AsyncBackend : public LogBackend {
+public:
+    /**
+     * What log() does when the queue is full
+     */
+    enum class OverflowPolicy : int {
+        DROP,   ///< Drop the record and count it, logging never blocks
+        BLOCK   ///< Wait for the writer thread to make room
+    };
+
+    /**
+     * @param backendPtr    wrapped backend, owned by the AsyncBackend, called only from the writer thread
+     * @param capacity      maximal number of queued records
+     * @param policy        behavior when the queue is full
+     */
+    AsyncBackend(LogBackend* backendPtr,
+                 const size_t capacity = 8192,
+                 const OverflowPolicy policy = OverflowPolicy::DROP);
+    ~AsyncBackend();
+
+    AsyncBackend(const AsyncBackend&) = delete;
+    AsyncBackend& operator=(const AsyncBackend&) = delete;
+
+    void log(LogLevel logLevel,
+             const std::string& file,
+             const unsigned int& line,
+             const std::string& func,
+             const std::string& message) override;
+
+    /**
+     * Passed synchronously to the wrapped backend, after the queued records
+     */
+    void relog(LogLevel logLevel,
+               const std::string& file,
+               const unsigned int& line,
+               const std::string& func,
+               const std::istream& stream) override;
+
+    /**
+     * Blocks till all the records logged so far are written by the wrapped backend
+     */
+    void flush() override;
+
+    bool isThreadSafe() const override;
+
+    /**
+     * @return number of records dropped because the queue was full
+     */
+    unsigned long long getDroppedCount() const;
+
+    /**
+     * Sets handlers of the fatal signals (SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL)
+     * that write the queued records of the living AsyncBackend and re-raise the signal.
+     * Writing from a signal handler is a best effort, it's not async-signal-safe.
+     */
+    static void installCrashHandler();
+
+private:
+    struct Record {
+        LogLevel logLevel;
+        std::string file;
+        unsigned int line;
+        std::string func;
+        std::string message;
+        struct timeval time;
+        unsigned int threadId;
+    };
+
+    std::unique_ptr<LogBackend> mBackendPtr;
+    OverflowPolicy mPolicy;
+    RingBuffer<Record> mRecords;
+
+    // Only one thread at a time consumes the records: the writer, flush() or the crash handler
+    std::mutex mConsumerMutex;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    std::atomic<bool> mIsWriterSleeping;
+    std::atomic<unsigned long long> mDroppedCount;
+    bool mIsStopping;
+
+    std::thread mWriterThread;
+
+    void run();
+    void wakeWriter();
+
+    /**
+     * Writes all queued records, mConsumerMutex has to be locked
+     * @return number of written records
+     */
+    size_t writeAll();
+
+    static void handleCrash(int sigNum);
+};
+
+} // namespace logger
+
+#endif // LOGGER_BACKEND_ASYNC_HPP
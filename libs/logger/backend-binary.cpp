@@ -0,0 +1,193 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Binary log backend, the logs are formatted offline by the decoder
+ */
+
+#include "config.hpp"
+
+#include "logger/backend-binary.hpp"
+#include "logger/formatter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace logger {
+
+namespace {
+
+template<typename T>
+void append(std::string& buffer, const T value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendString16(std::string& buffer, const char* value)
+{
+    const std::uint16_t size = static_cast<std::uint16_t>(std::min<size_t>(::strlen(value), UINT16_MAX));
+    append(buffer, size);
+    buffer.append(value, size);
+}
+
+} // namespace
+
+BinaryBackend::BinaryBackend(const std::string& filePath,
+                             const size_t bufferSize,
+                             const unsigned int flushIntervalMS)
+    : mFilePath(filePath),
+      mBufferSize(bufferSize),
+      mFlushInterval(flushIntervalMS),
+      mFD(-1),
+      mLastFlush(std::chrono::steady_clock::now()),
+      mNextSiteId(0)
+{
+    mBuffer.reserve(bufferSize);
+    mFD = ::open(mFilePath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    append(mBuffer, binary::RecordType::HEADER);
+    mBuffer.append(binary::MAGIC, sizeof(binary::MAGIC));
+    append(mBuffer, binary::VERSION);
+    append(mBuffer, static_cast<std::int32_t>(::getpid()));
+    flush();
+}
+
+BinaryBackend::~BinaryBackend()
+{
+    flush();
+    if (mFD != -1) {
+        ::close(mFD);
+    }
+}
+
+void BinaryBackend::log(LogLevel logLevel,
+                        const std::string& file,
+                        const unsigned int& line,
+                        const std::string& func,
+                        const std::string& message)
+{
+    appendMessage(logLevel, getSiteId(file, line, func), message);
+}
+
+void BinaryBackend::logCallSite(LogLevel logLevel,
+                                const char* file,
+                                const unsigned int line,
+                                const char* func,
+                                const std::string& message)
+{
+    const CallSite callSite = {file, line, func};
+    auto it = mCallSites.find(callSite);
+    if (it == mCallSites.end()) {
+        it = mCallSites.emplace(callSite, addSite(file, line, func)).first;
+    }
+
+    appendMessage(logLevel, it->second, message);
+}
+
+void BinaryBackend::appendMessage(LogLevel logLevel,
+                                  const std::uint32_t siteId,
+                                  const std::string& message)
+{
+    append(mBuffer, binary::RecordType::MESSAGE);
+    append(mBuffer, LogFormatter::getCurrentTimeNS());
+    append(mBuffer, static_cast<std::uint8_t>(logLevel));
+    append(mBuffer, siteId);
+    append(mBuffer, static_cast<std::uint32_t>(LogFormatter::getCurrentThread()));
+    append(mBuffer, static_cast<std::uint32_t>(message.size()));
+    mBuffer.append(message);
+
+    if (mBuffer.size() >= mBufferSize ||
+        std::chrono::steady_clock::now() - mLastFlush >= mFlushInterval) {
+        flush();
+    }
+}
+
+void BinaryBackend::flush()
+{
+    mLastFlush = std::chrono::steady_clock::now();
+    if (mBuffer.empty()) {
+        return;
+    }
+
+    writeBuffer();
+    mBuffer.clear();
+}
+
+std::uint32_t BinaryBackend::getSiteId(const std::string& file,
+                                       const unsigned int line,
+                                       const std::string& func)
+{
+    std::hash<std::string> hashString;
+    const std::size_t key = (hashString(file) * 31 + hashString(func)) * 31 + line;
+
+    auto it = mSites.find(key);
+    if (it != mSites.end() &&
+        it->second.line == line && it->second.file == file && it->second.func == func) {
+        return it->second.id;
+    }
+
+    // New site or a hash collision, the collided site gets a new id when it logs again
+    Site& site = mSites[key];
+    site.id = addSite(file.c_str(), line, func.c_str());
+    site.file = file;
+    site.line = line;
+    site.func = func;
+    return site.id;
+}
+
+std::uint32_t BinaryBackend::addSite(const char* file,
+                                     const unsigned int line,
+                                     const char* func)
+{
+    const std::uint32_t id = mNextSiteId++;
+    append(mBuffer, binary::RecordType::SITE);
+    append(mBuffer, id);
+    append(mBuffer, static_cast<std::uint32_t>(line));
+    appendString16(mBuffer, file);
+    appendString16(mBuffer, func);
+    return id;
+}
+
+void BinaryBackend::writeBuffer()
+{
+    if (mFD == -1) {
+        // Nowhere to report the error, the records are lost
+        return;
+    }
+
+    const char* data = mBuffer.data();
+    size_t left = mBuffer.size();
+    while (left > 0) {
+        ssize_t written = ::write(mFD, data, left);
+        if (written == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        left -= static_cast<size_t>(written);
+    }
+}
+
+} // namespace logger
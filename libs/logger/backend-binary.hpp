@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Binary log backend, the logs are formatted offline by the decoder
+ */
+
+#ifndef LOGGER_BACKEND_BINARY_HPP
+#define LOGGER_BACKEND_BINARY_HPP
+
+#include "logger/backend.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace logger {
+
+/**
+ * Layout of the binary log file. All numbers are in the host byte order.
+ *
+ * The file is a sequence of records, each starts with a one byte type:
+ * - HEADER:  magic "CARGOLOG", uint32 version, int32 pid.
+ *            Written by every backend opening the file, forgets the previous call sites.
+ * - SITE:    uint32 site id, uint32 line, uint16 file length, file, uint16 func length, func.
+ *            Written before the first message of the call site.
+ * - MESSAGE: uint64 time in ns since the epoch, uint8 level, uint32 site id, uint32 thread id,
+ *            uint32 message length, message.
+ */
+namespace binary {
+
+const char MAGIC[] = {'C', 'A', 'R', 'G', 'O', 'L', 'O', 'G'};
+const std::uint32_t VERSION = 1;
+
+enum class RecordType : std::uint8_t {
+    HEADER = 0,
+    SITE = 1,
+    MESSAGE = 2
+};
+
+} // namespace binary
+
+/**
+ * Writes compact binary records instead of text lines.
+ *
+ * The header isn't formatted, file and function names are written once per call site.
+ * The message is still formatted by the log statement.
+ * The file is decoded to the text format with cargo-log-decoder.
+ * Buffering works like in the FileBackend: every record is written right away by default.
+ */
+class BinaryBackend : public LogBackend {
+public:
+    /**
+     * @param filePath          path to the log file, new logs are appended
+     * @param bufferSize        size of the buffered records that triggers writing, 0 writes every record
+     * @param flushIntervalMS   maximal time between writes of the buffered records
+     */
+    BinaryBackend(const std::string& filePath,
+                  const size_t bufferSize = 0,
+                  const unsigned int flushIntervalMS = 1000);
+    ~BinaryBackend();
+
+    BinaryBackend(const BinaryBackend&) = delete;
+    BinaryBackend& operator=(const BinaryBackend&) = delete;
+
+    /**
+     * Used when the backend is called directly or by another backend, e.g. AsyncBackend.
+     * The location is hashed and compared on every call.
+     */
+    void log(LogLevel logLevel,
+             const std::string& file,
+             const unsigned int& line,
+             const std::string& func,
+             const std::string& message) override;
+
+    /**
+     * Used by the Logger, the call site is found by the addresses of its file and func literals
+     */
+    void logCallSite(LogLevel logLevel,
+                     const char* file,
+                     const unsigned int line,
+                     const char* func,
+                     const std::string& message) override;
+
+    void flush() override;
+
+private:
+    struct Site {
+        std::uint32_t id;
+        std::string file;
+        unsigned int line;
+        std::string func;
+    };
+
+    struct CallSite {
+        const char* file;
+        unsigned int line;
+        const char* func;
+
+        bool operator==(const CallSite& other) const
+        {
+            return file == other.file && line == other.line && func == other.func;
+        }
+    };
+
+    struct CallSiteHash {
+        std::size_t operator()(const CallSite& site) const
+        {
+            std::hash<const void*> hashPointer;
+            return (hashPointer(site.file) * 31 + hashPointer(site.func)) * 31 + site.line;
+        }
+    };
+
+    std::string mFilePath;
+    size_t mBufferSize;
+    std::chrono::milliseconds mFlushInterval;
+
+    int mFD;
+    std::string mBuffer;
+    std::chrono::steady_clock::time_point mLastFlush;
+
+    // Call sites by the hash of their location
+    std::unordered_map<std::size_t, Site> mSites;
+    // Ids of the call sites logging through the Logger
+    std::unordered_map<CallSite, std::uint32_t, CallSiteHash> mCallSites;
+    std::uint32_t mNextSiteId;
+
+    std::uint32_t getSiteId(const std::string& file,
+                            const unsigned int line,
+                            const std::string& func);
+    std::uint32_t addSite(const char* file,
+                          const unsigned int line,
+                          const char* func);
+    void appendMessage(LogLevel logLevel,
+                       const std::uint32_t siteId,
+                       const std::string& message);
+    void writeBuffer();
+};
+
+} // namespace logger
+
+#endif // LOGGER_BACKEND_BINARY_HPP
@@ -27,21 +27,129 @@
 #include "logger/formatter.hpp"
 #include "logger/backend-file.hpp"
 
-#include <fstream>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace logger {
 
+FileBackend::FileBackend(const std::string& filePath,
+                         const size_t bufferSize,
+                         const unsigned int flushIntervalMS,
+                         const size_t maxFileSize,
+                         const unsigned int maxRotatedFiles)
+    : mfilePath(filePath),
+      mBufferSize(bufferSize),
+      mFlushInterval(flushIntervalMS),
+      mMaxFileSize(maxFileSize),
+      mMaxRotatedFiles(maxRotatedFiles),
+      mFD(-1),
+      mFileSize(0),
+      mLastFlush(std::chrono::steady_clock::now())
+{
+    mBuffer.reserve(bufferSize);
+    openFile();
+}
+
+FileBackend::~FileBackend()
+{
+    flush();
+    closeFile();
+}
+
 void FileBackend::log(LogLevel logLevel,
                       const std::string& file,
                       const unsigned int& line,
                       const std::string& func,
                       const std::string& message)
 {
-    std::ofstream out(mfilePath, std::ios::app);
-    out << LogFormatter::getHeader(logLevel, file, line, func);
-    out << message;
-    out << std::endl;
+    LogFormatter::appendHeader(mBuffer, logLevel, file, line, func);
+    mBuffer.append(message);
+    mBuffer.push_back('\n');
+
+    if (mBuffer.size() >= mBufferSize ||
+        std::chrono::steady_clock::now() - mLastFlush >= mFlushInterval) {
+        flush();
+    }
+}
+
+void FileBackend::flush()
+{
+    mLastFlush = std::chrono::steady_clock::now();
+    if (mBuffer.empty()) {
+        return;
+    }
+
+    if (mMaxFileSize > 0 && mFD != -1 && mFileSize + mBuffer.size() > mMaxFileSize) {
+        rotate();
+    }
+
+    writeBuffer();
+    mBuffer.clear();
 }
 
+bool FileBackend::openFile()
+{
+    // Retried on the next flush, like reopening the file for every line did
+    mFD = ::open(mfilePath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (mFD == -1) {
+        return false;
+    }
+
+    struct ::stat st;
+    mFileSize = ::fstat(mFD, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    return true;
+}
+
+void FileBackend::closeFile()
+{
+    if (mFD != -1) {
+        ::close(mFD);
+        mFD = -1;
+    }
+}
+
+void FileBackend::rotate()
+{
+    closeFile();
+
+    for (unsigned int i = mMaxRotatedFiles; i > 1; --i) {
+        const std::string from = mfilePath + "." + std::to_string(i - 1);
+        const std::string to = mfilePath + "." + std::to_string(i);
+        ::rename(from.c_str(), to.c_str());
+    }
+
+    if (mMaxRotatedFiles > 0) {
+        ::rename(mfilePath.c_str(), (mfilePath + ".1").c_str());
+    } else {
+        ::unlink(mfilePath.c_str());
+    }
+}
+
+void FileBackend::writeBuffer()
+{
+    if (mFD == -1 && !openFile()) {
+        return;
+    }
+
+    // All the buffered lines go in one write
+    const char* data = mBuffer.data();
+    size_t left = mBuffer.size();
+    while (left > 0) {
+        ssize_t written = ::write(mFD, data, left);
+        if (written == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // Nowhere to report the error, the lines are lost
+            return;
+        }
+        data += written;
+        left -= static_cast<size_t>(written);
+        mFileSize += static_cast<size_t>(written);
+    }
+}
 
 } // namespace logger
@@ -27,18 +27,66 @@
 
 #include "logger/backend.hpp"
 
+#include <chrono>
+#include <string>
+
 namespace logger {
 
+/**
+ * Appends logs to a file.
+ *
+ * The file is kept open and by default every line is written right away.
+ * Buffering is opt-in: with bufferSize set the lines are collected in a buffer,
+ * it's written when it reaches bufferSize or when flushIntervalMS passed since the last write.
+ * The interval is checked on logging, so the last lines may wait till the next log,
+ * flush() or the destruction of the backend and are lost on a crash.
+ * With AsyncBackend the buffer is written after every batch.
+ *
+ * If maxFileSize is set the file is rotated: file.log -> file.log.1 -> ... -> file.log.<maxRotatedFiles>
+ */
 class FileBackend : public LogBackend {
 public:
-    FileBackend(const std::string& filePath) : mfilePath(filePath) {}
+    /**
+     * @param filePath          path to the log file
+     * @param bufferSize        size of the buffered logs that triggers writing, 0 writes every line
+     * @param flushIntervalMS   maximal time between writes of the buffered logs
+     * @param maxFileSize       size that triggers rotation, 0 disables rotation
+     * @param maxRotatedFiles   number of kept rotated files
+     */
+    FileBackend(const std::string& filePath,
+                const size_t bufferSize = 0,
+                const unsigned int flushIntervalMS = 1000,
+                const size_t maxFileSize = 0,
+                const unsigned int maxRotatedFiles = 1);
+    ~FileBackend();
+
+    FileBackend(const FileBackend&) = delete;
+    FileBackend& operator=(const FileBackend&) = delete;
+
     void log(LogLevel logLevel,
              const std::string& file,
              const unsigned int& line,
              const std::string& func,
              const std::string& message) override;
+
+    void flush() override;
+
 private:
     std::string mfilePath;
+    size_t mBufferSize;
+    std::chrono::milliseconds mFlushInterval;
+    size_t mMaxFileSize;
+    unsigned int mMaxRotatedFiles;
+
+    int mFD;
+    size_t mFileSize;
+    std::string mBuffer;
+    std::chrono::steady_clock::time_point mLastFlush;
+
+    bool openFile();
+    void closeFile();
+    void rotate();
+    void writeBuffer();
 };
 
 } // namespace logger
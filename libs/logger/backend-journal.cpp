@@ -30,6 +30,11 @@
 #define SD_JOURNAL_SUPPRESS_LOCATION
 #include <systemd/sd-journal.h>
 
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <endian.h>
+
 namespace logger {
 
 namespace {
@@ -54,14 +59,62 @@ inline int toJournalPriority(LogLevel logLevel)
     }
 }
 
+// KEY=value line of the native protocol, values with new lines are prefixed with their size instead
+void appendField(std::string& datagram, const char* key, const char* value, const size_t size)
+{
+    datagram += key;
+    if (std::memchr(value, '\n', size) == nullptr) {
+        datagram += '=';
+    } else {
+        const std::uint64_t encodedSize = htole64(static_cast<std::uint64_t>(size));
+        datagram += '\n';
+        datagram.append(reinterpret_cast<const char*>(&encodedSize), sizeof(encodedSize));
+    }
+    datagram.append(value, size);
+    datagram += '\n';
+}
+
+void appendField(std::string& datagram, const char* key, const std::string& value)
+{
+    appendField(datagram, key, value.data(), value.size());
+}
+
 } // namespace
 
+SystemdJournalBackend::SystemdJournalBackend(const size_t maxBatchSize, const std::string& socketPath)
+{
+    if (maxBatchSize > 0) {
+        mBatch.reset(new DatagramBatch(socketPath, maxBatchSize));
+    }
+}
+
+SystemdJournalBackend::~SystemdJournalBackend()
+{
+    flush();
+}
+
 void SystemdJournalBackend::log(LogLevel logLevel,
                                 const std::string& file,
                                 const unsigned int& line,
                                 const std::string& func,
                                 const std::string& message)
 {
+    if (mBatch) {
+        std::string& datagram = mBatch->next();
+        appendField(datagram, "PRIORITY", std::to_string(toJournalPriority(logLevel)));
+        appendField(datagram, "CODE_FILE", file);
+        appendField(datagram, "CODE_LINE", std::to_string(line));
+        appendField(datagram, "CODE_FUNC", func);
+        appendField(datagram, "SYSLOG_IDENTIFIER", program_invocation_short_name,
+                    std::strlen(program_invocation_short_name));
+        appendField(datagram, "MESSAGE", message);
+
+        if (mBatch->isReady()) {
+            mBatch->send();
+        }
+        return;
+    }
+
     sd_journal_send("PRIORITY=%d", toJournalPriority(logLevel),
                     "CODE_FILE=%s", file.c_str(),
                     "CODE_LINE=%d", line,
@@ -70,5 +123,12 @@ void SystemdJournalBackend::log(LogLevel logLevel,
                     NULL);
 }
 
+void SystemdJournalBackend::flush()
+{
+    if (mBatch) {
+        mBatch->send();
+    }
+}
+
 } // namespace logger
 #endif // HAVE_SYSTEMD
@@ -26,19 +26,46 @@
 #define LOGGER_BACKEND_JOURNAL_HPP
 
 #include "logger/backend.hpp"
+#include "logger/datagram-batch.hpp"
+
+#include <memory>
+#include <string>
 
 namespace logger {
 
 /**
  * systemd journal logging backend
+ *
+ * By default every record is sent with sd_journal_send(). With maxBatchSize set, the records
+ * are encoded in the journal native protocol and sent to the journal socket with one system call
+ * when maxBatchSize of them is collected, when a record is logged a second after the first one
+ * of the batch, on flush() or on the destruction. There is no timer, so without AsyncBackend
+ * the last records wait for the next log. Wrapped in AsyncBackend the sending happens
+ * in its writer thread, after every batch of records.
  */
 class SystemdJournalBackend : public LogBackend {
 public:
+    /**
+     * @param maxBatchSize  number of records sent together, 0 disables batching
+     * @param socketPath    journal native protocol socket, used only with batching
+     */
+    SystemdJournalBackend(const size_t maxBatchSize = 0,
+                          const std::string& socketPath = "/run/systemd/journal/socket");
+    ~SystemdJournalBackend();
+
+    SystemdJournalBackend(const SystemdJournalBackend&) = delete;
+    SystemdJournalBackend& operator=(const SystemdJournalBackend&) = delete;
+
     void log(LogLevel logLevel,
              const std::string& file,
              const unsigned int& line,
              const std::string& func,
              const std::string& message) override;
+
+    void flush() override;
+
+private:
+    std::unique_ptr<DatagramBatch> mBatch;
 };
 
 } // namespace logger
@@ -37,7 +37,7 @@ void PersistentFileBackend::log(LogLevel logLevel,
                                 const std::string& func,
                                 const std::string& message)
 {
-    mOut << LogFormatter::getHeader(logLevel, file, line, func);
+    mOut << LogFormatter::formatHeader(logLevel, file, line, func);
     mOut << message;
     mOut << std::endl;
     mOut.flush();
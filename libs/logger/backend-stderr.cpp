@@ -46,7 +46,7 @@ void StderrBackend::log(LogLevel logLevel,
 
     const std::string logColor = LogFormatter::getConsoleColor(logLevel);
     const std::string defaultColor = LogFormatter::getDefaultConsoleColor();
-    const std::string header = LogFormatter::getHeader(logLevel, file, line, func);
+    const std::string& header = LogFormatter::formatHeader(logLevel, file, line, func);
     tokenizer tokens(message, charSeparator("\n"));
     for (const auto& messageLine : tokens) {
         if (!messageLine.empty()) {
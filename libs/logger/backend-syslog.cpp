@@ -27,8 +27,10 @@
 #include "logger/formatter.hpp"
 #include "logger/backend-syslog.hpp"
 
+#include <cerrno>
+#include <string>
 #include <syslog.h>
-#include <sstream>
+#include <time.h>
 namespace logger {
 
 namespace {
@@ -55,13 +57,69 @@ inline int toSyslogPriority(LogLevel logLevel)
 
 } // namespace
 
+SyslogBackend::SyslogBackend(const size_t maxBatchSize, const std::string& socketPath)
+    : mCachedSecond(-1)
+{
+    if (maxBatchSize > 0) {
+        mBatch.reset(new DatagramBatch(socketPath, maxBatchSize));
+    }
+}
+
+SyslogBackend::~SyslogBackend()
+{
+    flush();
+}
+
 void SyslogBackend::log(LogLevel logLevel,
                         const std::string& file,
                         const unsigned int& line,
                         const std::string& func,
                         const std::string& message)
 {
-    ::syslog(toSyslogPriority(logLevel), "%s %s", LogFormatter::getHeader(logLevel, file, line, func).c_str(), message.c_str());
+    if (!mBatch) {
+        ::syslog(toSyslogPriority(logLevel), "%s %s", LogFormatter::formatHeader(logLevel, file, line, func).c_str(), message.c_str());
+        return;
+    }
+
+    // <PRI>Mmm dd hh:mm:ss TAG[PID]: MESSAGE, same as ::syslog() sends
+    std::string& datagram = mBatch->next();
+    datagram += '<';
+    datagram += std::to_string(LOG_USER | toSyslogPriority(logLevel));
+    datagram += '>';
+    appendTimestamp(datagram);
+    datagram += ' ';
+    datagram += program_invocation_short_name;
+    datagram += '[';
+    datagram += std::to_string(LogFormatter::getCurrentPid());
+    datagram += "]: ";
+    LogFormatter::appendHeader(datagram, logLevel, file, line, func);
+    datagram += ' ';
+    datagram += message;
+
+    if (mBatch->isReady()) {
+        mBatch->send();
+    }
+}
+
+void SyslogBackend::flush()
+{
+    if (mBatch) {
+        mBatch->send();
+    }
+}
+
+void SyslogBackend::appendTimestamp(std::string& datagram)
+{
+    const time_t second = static_cast<time_t>(LogFormatter::getCurrentTimeNS() / 1000000000ULL);
+    if (second != mCachedSecond) {
+        struct tm tm;
+        ::localtime_r(&second, &tm);
+        if (::strftime(mCachedTimestamp, sizeof(mCachedTimestamp), "%b %e %H:%M:%S", &tm) == 0) {
+            mCachedTimestamp[0] = '\0';
+        }
+        mCachedSecond = second;
+    }
+    datagram += mCachedTimestamp;
 }
 
 } // namespace logger
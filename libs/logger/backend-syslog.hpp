@@ -26,16 +26,52 @@
 #define LOGGER_BACKEND_SYSLOG_HPP
 
 #include "logger/backend.hpp"
+#include "logger/datagram-batch.hpp"
+
+#include <ctime>
+#include <memory>
+#include <string>
 
 namespace logger {
 
+/**
+ * Sends logs to syslog.
+ *
+ * By default every record is passed to ::syslog() right away. With maxBatchSize set, the records
+ * are formatted as RFC 3164 datagrams and sent to the syslog socket with one system call
+ * when maxBatchSize of them is collected, when a record is logged a second after the first one
+ * of the batch, on flush() or on the destruction. There is no timer, so without AsyncBackend
+ * the last records wait for the next log. Wrapped in AsyncBackend the sending happens
+ * in its writer thread, after every batch of records.
+ */
 class SyslogBackend : public LogBackend {
 public:
+    /**
+     * @param maxBatchSize  number of records sent together, 0 disables batching
+     * @param socketPath    syslog socket, used only with batching
+     */
+    SyslogBackend(const size_t maxBatchSize = 0,
+                  const std::string& socketPath = "/dev/log");
+    ~SyslogBackend();
+
+    SyslogBackend(const SyslogBackend&) = delete;
+    SyslogBackend& operator=(const SyslogBackend&) = delete;
+
     void log(LogLevel logLevel,
              const std::string& file,
              const unsigned int& line,
              const std::string& func,
              const std::string& message) override;
+
+    void flush() override;
+
+private:
+    std::unique_ptr<DatagramBatch> mBatch;
+    // "Mmm dd hh:mm:ss" of the last used second
+    time_t mCachedSecond;
+    char mCachedTimestamp[16];
+
+    void appendTimestamp(std::string& datagram);
 };
 
 } // namespace logger
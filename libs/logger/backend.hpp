@@ -42,12 +42,39 @@ public:
                      const unsigned int& line,
                      const std::string& func,
                      const std::string& message) = 0;
+    /**
+     * Called by the Logger. The file and func are string literals of the call site,
+     * so their addresses identify it. Passes the call to log() by default.
+     */
+    virtual void logCallSite(LogLevel logLevel,
+                             const char* file,
+                             const unsigned int line,
+                             const char* func,
+                             const std::string& message)
+    {
+        log(logLevel, file, line, func, message);
+    }
+
     virtual void relog(LogLevel /*logLevel*/,
                      const std::string& /*file*/,
                      const unsigned int& /*line*/,
                      const std::string& /*func*/,
                      const std::istream& /*stream*/) {}
 
+    /**
+     * Writes out the buffered logs, if the backend buffers any
+     */
+    virtual void flush() {}
+
+    /**
+     * @return true if log() can be called from many threads at once,
+     *         otherwise the Logger serializes the calls
+     */
+    virtual bool isThreadSafe() const
+    {
+        return false;
+    }
+
     virtual ~LogBackend() {}
 };
 
@@ -0,0 +1,152 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Decoder of the logs written by the BinaryBackend
+ */
+
+#include "config.hpp"
+
+#include "logger/binary-decoder.hpp"
+#include "logger/backend-binary.hpp"
+#include "logger/formatter.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace logger {
+
+BinaryDecoder::BinaryDecoder(std::istream& in)
+    : mIn(in),
+      mPid(0),
+      mIsHeaderRead(false)
+{
+}
+
+bool BinaryDecoder::next(Message& message)
+{
+    for (;;) {
+        char type;
+        if (!mIn.get(type)) {
+            return false;
+        }
+
+        switch (static_cast<binary::RecordType>(type)) {
+        case binary::RecordType::HEADER:
+            readHeader();
+            break;
+        case binary::RecordType::SITE:
+            readSite();
+            break;
+        case binary::RecordType::MESSAGE:
+            readMessage(message);
+            return true;
+        default:
+            throw std::runtime_error("Unknown log record type: " + std::to_string(type));
+        }
+    }
+}
+
+std::string BinaryDecoder::format(const Message& message)
+{
+    struct timeval time;
+    time.tv_sec = static_cast<time_t>(message.timeNS / 1000000000ULL);
+    time.tv_usec = static_cast<suseconds_t>(message.timeNS % 1000000000ULL / 1000ULL);
+
+    LogFormatter::RecordScope scope(time, message.threadId, message.pid);
+    return LogFormatter::formatHeader(message.level, message.file, message.line, message.func) +
+           message.message;
+}
+
+void BinaryDecoder::readHeader()
+{
+    char magic[sizeof(binary::MAGIC)];
+    read(magic, sizeof(magic));
+    if (0 != ::memcmp(magic, binary::MAGIC, sizeof(magic))) {
+        throw std::runtime_error("Not a binary log");
+    }
+
+    const std::uint32_t version = read<std::uint32_t>();
+    if (version > binary::VERSION) {
+        throw std::runtime_error("Unsupported binary log version: " + std::to_string(version));
+    }
+
+    mPid = static_cast<pid_t>(read<std::int32_t>());
+    mSites.clear();
+    mIsHeaderRead = true;
+}
+
+void BinaryDecoder::readSite()
+{
+    if (!mIsHeaderRead) {
+        throw std::runtime_error("Not a binary log");
+    }
+
+    const std::uint32_t id = read<std::uint32_t>();
+    Site& site = mSites[id];
+    site.line = read<std::uint32_t>();
+    site.file = readString(read<std::uint16_t>());
+    site.func = readString(read<std::uint16_t>());
+}
+
+void BinaryDecoder::readMessage(Message& message)
+{
+    if (!mIsHeaderRead) {
+        throw std::runtime_error("Not a binary log");
+    }
+
+    message.timeNS = read<std::uint64_t>();
+    const std::uint8_t level = read<std::uint8_t>();
+    if (level > static_cast<std::uint8_t>(LogLevel::HELP)) {
+        throw std::runtime_error("Invalid log level: " + std::to_string(level));
+    }
+    message.level = static_cast<LogLevel>(level);
+
+    const std::uint32_t siteId = read<std::uint32_t>();
+    auto it = mSites.find(siteId);
+    if (it == mSites.end()) {
+        throw std::runtime_error("Unknown call site: " + std::to_string(siteId));
+    }
+    message.file = it->second.file;
+    message.line = it->second.line;
+    message.func = it->second.func;
+
+    message.pid = mPid;
+    message.threadId = read<std::uint32_t>();
+    message.message = readString(read<std::uint32_t>());
+}
+
+void BinaryDecoder::read(void* data, const size_t size)
+{
+    mIn.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    if (static_cast<size_t>(mIn.gcount()) != size) {
+        throw std::runtime_error("Truncated log record");
+    }
+}
+
+std::string BinaryDecoder::readString(const size_t size)
+{
+    std::string value(size, '\0');
+    if (size > 0) {
+        read(&value[0], size);
+    }
+    return value;
+}
+
+} // namespace logger
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Decoder of the logs written by the BinaryBackend
+ */
+
+#ifndef LOGGER_BINARY_DECODER_HPP
+#define LOGGER_BINARY_DECODER_HPP
+
+#include "logger/level.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+
+namespace logger {
+
+/**
+ * Reads the records written by the BinaryBackend
+ */
+class BinaryDecoder {
+public:
+    struct Message {
+        std::uint64_t timeNS;
+        LogLevel level;
+        pid_t pid;
+        unsigned int threadId;
+        std::string file;
+        unsigned int line;
+        std::string func;
+        std::string message;
+    };
+
+    explicit BinaryDecoder(std::istream& in);
+
+    /**
+     * Reads the next message, skips the other records
+     *
+     * @param message   filled with the read message
+     * @return          false at the end of the logs
+     * @throw std::runtime_error on corrupted or truncated logs
+     */
+    bool next(Message& message);
+
+    /**
+     * @return the message formatted like by the text backends
+     */
+    static std::string format(const Message& message);
+
+private:
+    struct Site {
+        std::string file;
+        unsigned int line;
+        std::string func;
+    };
+
+    std::istream& mIn;
+    pid_t mPid;
+    bool mIsHeaderRead;
+    std::unordered_map<std::uint32_t, Site> mSites;
+
+    void readHeader();
+    void readSite();
+    void readMessage(Message& message);
+    void read(void* data, const size_t size);
+    std::string readString(const size_t size);
+
+    template<typename T>
+    T read()
+    {
+        T value;
+        read(&value, sizeof(value));
+        return value;
+    }
+};
+
+} // namespace logger
+
+#endif // LOGGER_BINARY_DECODER_HPP
@@ -0,0 +1,158 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Batch of datagrams sent to a local socket with one system call
+ */
+
+#include "config.hpp"
+
+#include "logger/datagram-batch.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace logger {
+
+namespace {
+
+const std::chrono::seconds MAX_DELAY(1);
+
+// Limit of a single sendmmsg() call
+const size_t MAX_DATAGRAMS_PER_CALL = 1024;
+
+} // namespace
+
+DatagramBatch::DatagramBatch(const std::string& socketPath, const size_t maxSize)
+    : mSocketPath(socketPath),
+      mMaxSize(std::max<size_t>(maxSize, 1)),
+      mFD(-1),
+      mSize(0)
+{
+    mDatagrams.reserve(mMaxSize);
+}
+
+DatagramBatch::~DatagramBatch()
+{
+    disconnect();
+}
+
+std::string& DatagramBatch::next()
+{
+    if (mSize == 0) {
+        mFirstTime = std::chrono::steady_clock::now();
+    }
+    if (mSize == mDatagrams.size()) {
+        mDatagrams.emplace_back();
+    }
+
+    std::string& datagram = mDatagrams[mSize++];
+    datagram.clear();
+    return datagram;
+}
+
+bool DatagramBatch::isReady() const
+{
+    return mSize >= mMaxSize ||
+           (mSize > 0 && std::chrono::steady_clock::now() - mFirstTime >= MAX_DELAY);
+}
+
+size_t DatagramBatch::size() const
+{
+    return mSize;
+}
+
+void DatagramBatch::send()
+{
+    if (mSize == 0) {
+        return;
+    }
+    if (mFD == -1 && !connect()) {
+        mSize = 0;
+        return;
+    }
+
+    std::vector<struct iovec> iovs(mSize);
+    std::vector<struct mmsghdr> messages(mSize);
+    for (size_t i = 0; i < mSize; ++i) {
+        iovs[i].iov_base = &mDatagrams[i][0];
+        iovs[i].iov_len = mDatagrams[i].size();
+        std::memset(&messages[i], 0, sizeof(messages[i]));
+        messages[i].msg_hdr.msg_iov = &iovs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    size_t sent = 0;
+    while (sent < mSize) {
+        const unsigned int count = static_cast<unsigned int>(std::min(mSize - sent, MAX_DATAGRAMS_PER_CALL));
+        int ret = ::sendmmsg(mFD, &messages[sent], count, MSG_NOSIGNAL);
+        if (ret == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EMSGSIZE) {
+                // Too big for the receiver, skip it
+                ++sent;
+                continue;
+            }
+            // The receiver is gone, try again with the next batch
+            disconnect();
+            break;
+        }
+        sent += static_cast<size_t>(ret);
+    }
+    mSize = 0;
+}
+
+bool DatagramBatch::connect()
+{
+    struct sockaddr_un address;
+    if (mSocketPath.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+
+    mFD = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (mFD == -1) {
+        return false;
+    }
+
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, mSocketPath.c_str(), sizeof(address.sun_path) - 1);
+    if (::connect(mFD, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == -1) {
+        disconnect();
+        return false;
+    }
+    return true;
+}
+
+void DatagramBatch::disconnect()
+{
+    if (mFD != -1) {
+        ::close(mFD);
+        mFD = -1;
+    }
+}
+
+} // namespace logger
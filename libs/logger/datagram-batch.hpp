@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Batch of datagrams sent to a local socket with one system call
+ */
+
+#ifndef LOGGER_DATAGRAM_BATCH_HPP
+#define LOGGER_DATAGRAM_BATCH_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace logger {
+
+/**
+ * Collects datagrams and sends them to a UNIX datagram socket (e.g. /dev/log) with sendmmsg().
+ * The buffers of the datagrams are reused between the batches.
+ *
+ * Nothing is reported on errors, the datagrams are dropped,
+ * the socket is connected again before the next batch.
+ */
+class DatagramBatch {
+public:
+    /**
+     * @param socketPath    path to the receiving socket
+     * @param maxSize       number of datagrams that makes the batch ready to send
+     */
+    DatagramBatch(const std::string& socketPath, const size_t maxSize);
+    ~DatagramBatch();
+
+    DatagramBatch(const DatagramBatch&) = delete;
+    DatagramBatch& operator=(const DatagramBatch&) = delete;
+
+    /**
+     * @return empty buffer for the next datagram
+     */
+    std::string& next();
+
+    /**
+     * The age of the batch is checked only when this is called, nothing is sent in the background.
+     *
+     * @return true if the batch is full or its first datagram waits longer than a second
+     */
+    bool isReady() const;
+
+    size_t size() const;
+
+    /**
+     * Sends all the collected datagrams
+     */
+    void send();
+
+private:
+    std::string mSocketPath;
+    size_t mMaxSize;
+    int mFD;
+    std::vector<std::string> mDatagrams;
+    size_t mSize;
+    std::chrono::steady_clock::time_point mFirstTime;
+
+    bool connect();
+    void disconnect();
+};
+
+} // namespace logger
+
+#endif // LOGGER_DATAGRAM_BATCH_HPP
@@ -0,0 +1,79 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Formats the logs written by the BinaryBackend
+ *
+ * Usage: cargo-log-decoder [FILE]
+ */
+
+#include "config.hpp"
+
+#include "logger/binary-decoder.hpp"
+
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+using namespace logger;
+
+namespace {
+
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [FILE]" << std::endl
+              << "Prints the binary logs from the FILE or the standard input as text." << std::endl;
+}
+
+int decode(std::istream& in)
+{
+    BinaryDecoder decoder(in);
+    BinaryDecoder::Message message;
+    try {
+        while (decoder.next(message)) {
+            std::cout << BinaryDecoder::format(message) << '\n';
+        }
+    } catch (const std::exception& e) {
+        std::cout.flush();
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc > 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (argc == 1) {
+        return decode(std::cin);
+    }
+
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::cerr << "Can't open " << argv[1] << std::endl;
+        return 1;
+    }
+    return decode(file);
+}
@@ -29,11 +29,13 @@
 
 #include <unistd.h>
 #include <sys/time.h>
+#include <time.h>
 #include <cassert>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
+#include <cstring>
 #include <thread>
 #include <atomic>
+#include <pthread.h>
 
 namespace logger {
 
@@ -48,10 +50,135 @@ const int FILE_COLUMN_LENGTH = 60;
 std::atomic<unsigned int> gNextThreadId(1);
 thread_local unsigned int gThisThreadId(0);
 
+// Set by RecordScope
+thread_local const struct timeval* gRecordTimePtr(nullptr);
+thread_local unsigned int gRecordThreadId(0);
+thread_local pid_t gRecordPid(0);
+
+// "HH:MM:SS" of the last formatted second, only the milliseconds change more often
+thread_local time_t gCachedSecond(-1);
+thread_local char gCachedSecondText[9];
+
+// Reused by formatHeader
+thread_local std::string gHeaderBuffer;
+
+// 0 till the first use and in the child after fork()
+std::atomic<pid_t> gPid(0);
+
+pid_t getPid()
+{
+    if (gRecordPid != 0) {
+        return gRecordPid;
+    }
+
+    pid_t pid = gPid.load(std::memory_order_relaxed);
+    if (pid == 0) {
+        static const int atForkResult = ::pthread_atfork(nullptr, nullptr, [] {
+            gPid.store(0, std::memory_order_relaxed);
+        });
+        (void)atForkResult;
+
+        pid = ::getpid();
+        gPid.store(pid, std::memory_order_relaxed);
+    }
+    return pid;
+}
+
+const char* getLevelText(const LogLevel logLevel)
+{
+    switch (logLevel) {
+    case LogLevel::ERROR:
+        return "[ERROR]";
+    case LogLevel::WARN:
+        return "[WARN]";
+    case LogLevel::INFO:
+        return "[INFO]";
+    case LogLevel::DEBUG:
+        return "[DEBUG]";
+    case LogLevel::TRACE:
+        return "[TRACE]";
+    case LogLevel::HELP:
+        return "[HELP]";
+    default:
+        return "[UNKNOWN]";
+    }
+}
+
+void appendPadding(std::string& buffer, const size_t size, const int width)
+{
+    if (size < static_cast<size_t>(width)) {
+        buffer.append(static_cast<size_t>(width) - size, ' ');
+    }
+}
+
+// Right aligned, like std::setw
+void appendNumber(std::string& buffer, unsigned long value, const int width)
+{
+    char digits[20];
+    size_t size = 0;
+    do {
+        digits[size++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    appendPadding(buffer, size, width);
+    while (size > 0) {
+        buffer.push_back(digits[--size]);
+    }
+}
+
+void appendTime(std::string& buffer)
+{
+    struct timeval tv;
+    if (gRecordTimePtr) {
+        tv = *gRecordTimePtr;
+    } else {
+        gettimeofday(&tv, NULL);
+    }
+
+    if (tv.tv_sec != gCachedSecond) {
+        struct tm tm;
+        ::localtime_r(&tv.tv_sec, &tm);
+        snprintf(gCachedSecondText,
+                 sizeof(gCachedSecondText),
+                 "%02d:%02d:%02d",
+                 tm.tm_hour,
+                 tm.tm_min,
+                 tm.tm_sec);
+        gCachedSecond = tv.tv_sec;
+    }
+
+    const int ms = static_cast<int>(tv.tv_usec / 1000);
+    const char msText[] = {'.',
+                           static_cast<char>('0' + ms / 100),
+                           static_cast<char>('0' + ms / 10 % 10),
+                           static_cast<char>('0' + ms % 10)};
+    buffer.append(gCachedSecondText, sizeof(gCachedSecondText) - 1);
+    buffer.append(msText, sizeof(msText));
+}
+
 } // namespace
 
+LogFormatter::RecordScope::RecordScope(const struct timeval& time, const unsigned int threadId, const pid_t pid)
+{
+    gRecordTimePtr = &time;
+    gRecordThreadId = threadId;
+    gRecordPid = pid;
+}
+
+LogFormatter::RecordScope::~RecordScope()
+{
+    gRecordTimePtr = nullptr;
+    gRecordThreadId = 0;
+    gRecordPid = 0;
+}
+
 unsigned int LogFormatter::getCurrentThread(void)
 {
+    if (gRecordThreadId != 0) {
+        return gRecordThreadId;
+    }
+
     unsigned int id = gThisThreadId;
     if (id == 0) {
         gThisThreadId = id = gNextThreadId++;
@@ -60,21 +187,29 @@ unsigned int LogFormatter::getCurrentThread(void)
     return id;
 }
 
+pid_t LogFormatter::getCurrentPid(void)
+{
+    return getPid();
+}
+
 std::string LogFormatter::getCurrentTime(void)
 {
-    char time[TIME_COLUMN_LENGTH + 1];
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    struct tm* tm = localtime(&tv.tv_sec);
-    snprintf(time,
-             sizeof(time),
-             "%02d:%02d:%02d.%03d",
-             tm->tm_hour,
-             tm->tm_min,
-             tm->tm_sec,
-             int(tv.tv_usec / 1000));
+    std::string time;
+    time.reserve(TIME_COLUMN_LENGTH);
+    appendTime(time);
+    return time;
+}
+
+std::uint64_t LogFormatter::getCurrentTimeNS(void)
+{
+    if (gRecordTimePtr) {
+        return static_cast<std::uint64_t>(gRecordTimePtr->tv_sec) * 1000000000ULL +
+               static_cast<std::uint64_t>(gRecordTimePtr->tv_usec) * 1000ULL;
+    }
 
-    return std::string(time);
+    struct timespec ts;
+    ::clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<std::uint64_t>(ts.tv_nsec);
 }
 
 std::string LogFormatter::getConsoleColor(LogLevel logLevel)
@@ -117,19 +252,66 @@ std::string LogFormatter::stripProjectDir(const std::string& file,
     return file.substr(sourceDir.size());
 }
 
+const char* LogFormatter::stripProjectDir(const char* file,
+                                          const char* rootDir)
+{
+    // If rootdir is empty then return full name
+    if (rootDir == nullptr || *rootDir == '\0') {
+        return file;
+    }
+    const size_t rootDirLength = ::strlen(rootDir);
+    // If file does not belong to rootDir then also return full name
+    if (0 != ::strncmp(file, rootDir, rootDirLength) || file[rootDirLength] != '/') {
+        return file;
+    }
+    return file + rootDirLength + 1;
+}
+
+void LogFormatter::appendHeader(std::string& buffer,
+                                LogLevel logLevel,
+                                const std::string& file,
+                                const unsigned int& line,
+                                const std::string& func)
+{
+    appendTime(buffer);
+    buffer.push_back(' ');
+
+    const char* levelText = getLevelText(logLevel);
+    const size_t levelSize = ::strlen(levelText);
+    buffer.append(levelText, levelSize);
+    appendPadding(buffer, levelSize, SEVERITY_COLUMN_LENGTH);
+
+    appendNumber(buffer, static_cast<unsigned long>(getPid()), PID_COLUMN_LENGTH);
+    buffer.push_back('/');
+    appendNumber(buffer, getCurrentThread(), TID_COLUMN_LENGTH);
+    buffer.append(": ");
+
+    const size_t locationBegin = buffer.size();
+    buffer.append(file);
+    buffer.push_back(':');
+    appendNumber(buffer, line, 0);
+    buffer.push_back(' ');
+    buffer.append(func);
+    buffer.push_back(':');
+    appendPadding(buffer, buffer.size() - locationBegin, FILE_COLUMN_LENGTH);
+}
+
+const std::string& LogFormatter::formatHeader(LogLevel logLevel,
+                                              const std::string& file,
+                                              const unsigned int& line,
+                                              const std::string& func)
+{
+    gHeaderBuffer.clear();
+    appendHeader(gHeaderBuffer, logLevel, file, line, func);
+    return gHeaderBuffer;
+}
+
 std::string LogFormatter::getHeader(LogLevel logLevel,
                                     const std::string& file,
                                     const unsigned int& line,
                                     const std::string& func)
 {
-    std::ostringstream logLine;
-    logLine << getCurrentTime() << ' '
-            << std::left << std::setw(SEVERITY_COLUMN_LENGTH) << '[' + toString(logLevel) + ']'
-            << std::right << std::setw(PID_COLUMN_LENGTH) << ::getpid() << "/"
-            << std::right << std::setw(TID_COLUMN_LENGTH) << getCurrentThread() << ": "
-            << std::left << std::setw(FILE_COLUMN_LENGTH)
-            << file + ':' + std::to_string(line) + ' ' + func + ':';
-    return logLine.str();
+    return formatHeader(logLevel, file, line, func);
 }
 
 } // namespace logger
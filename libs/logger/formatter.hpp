@@ -27,22 +27,72 @@
 
 #include "logger/level.hpp"
 
+#include <cstdint>
 #include <string>
+#include <sys/time.h>
+#include <sys/types.h>
 
 namespace logger {
 
 class LogFormatter {
 public:
+    /**
+     * Headers formatted on this thread, while the scope lives, use the given time and thread
+     * instead of the current ones. Used by backends that write records of other threads
+     * and by the decoder of the binary logs, which also passes the pid of the logging process.
+     */
+    class RecordScope {
+    public:
+        RecordScope(const struct timeval& time, const unsigned int threadId, const pid_t pid = 0);
+        ~RecordScope();
+
+        RecordScope(const RecordScope&) = delete;
+        RecordScope& operator=(const RecordScope&) = delete;
+    };
+
     static unsigned int getCurrentThread(void);
+    /**
+     * @return pid of this process, cached till the next fork()
+     */
+    static pid_t getCurrentPid(void);
     static std::string getCurrentTime(void);
+    /**
+     * @return wall clock time in nanoseconds since the epoch
+     */
+    static std::uint64_t getCurrentTimeNS(void);
     static std::string getConsoleColor(LogLevel logLevel);
     static std::string getDefaultConsoleColor(void);
     static std::string stripProjectDir(const std::string& file,
                                        const std::string& rootDir);
+    /**
+     * Same as above, but returns a pointer into the file, nothing is copied
+     */
+    static const char* stripProjectDir(const char* file,
+                                       const char* rootDir);
     static std::string getHeader(LogLevel logLevel,
                                  const std::string& file,
                                  const unsigned int& line,
                                  const std::string& func);
+
+    /**
+     * Appends the header to the buffer, allocates only if the buffer has to grow.
+     * The time prefix is formatted once per second and the pid once per process.
+     */
+    static void appendHeader(std::string& buffer,
+                             LogLevel logLevel,
+                             const std::string& file,
+                             const unsigned int& line,
+                             const std::string& func);
+
+    /**
+     * Formats the header into a thread local buffer
+     *
+     * @return the buffer, valid till the next call on this thread
+     */
+    static const std::string& formatHeader(LogLevel logLevel,
+                                           const std::string& file,
+                                           const unsigned int& line,
+                                           const std::string& func);
 };
 
 } // namespace logger
@@ -27,6 +27,32 @@
 
 #include <string>
 
+/**
+ * Numeric values of the log levels, usable in the preprocessor
+ * @ingroup libLogger
+ */
+#define LOGGER_LEVEL_TRACE 0
+#define LOGGER_LEVEL_DEBUG 1
+#define LOGGER_LEVEL_INFO  2
+#define LOGGER_LEVEL_WARN  3
+#define LOGGER_LEVEL_ERROR 4
+
+/**
+ * @brief Compile-time logging threshold
+ * @ingroup libLogger
+ *
+ * Log statements of a lower level are removed from the code, they cost nothing at runtime.
+ * Can be set per build or per file, e.g. -DLOGGER_MIN_LEVEL=LOGGER_LEVEL_WARN.
+ * By default release builds drop the debug and trace logs.
+ */
+#ifndef LOGGER_MIN_LEVEL
+#if defined(NDEBUG)
+#define LOGGER_MIN_LEVEL LOGGER_LEVEL_INFO
+#else
+#define LOGGER_MIN_LEVEL LOGGER_LEVEL_TRACE
+#endif
+#endif
+
 namespace logger {
 
 /**
@@ -42,6 +68,13 @@ enum class LogLevel : int {
     HELP   ///< Helper logs
 };
 
+static_assert(static_cast<int>(LogLevel::TRACE) == LOGGER_LEVEL_TRACE &&
+              static_cast<int>(LogLevel::DEBUG) == LOGGER_LEVEL_DEBUG &&
+              static_cast<int>(LogLevel::INFO) == LOGGER_LEVEL_INFO &&
+              static_cast<int>(LogLevel::WARN) == LOGGER_LEVEL_WARN &&
+              static_cast<int>(LogLevel::ERROR) == LOGGER_LEVEL_ERROR,
+              "LOGGER_LEVEL_* values have to match LogLevel");
+
 /**
  * @param logLevel LogLevel
  * @return std::sting representation of the LogLevel value
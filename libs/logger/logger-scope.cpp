@@ -34,29 +34,18 @@ SStreamWrapper::operator std::string() const
     return mSStream.str();
 }
 
-LoggerScope::LoggerScope(const std::string& file,
-                         const unsigned int line,
-                         const std::string& func,
-                         const std::string& message,
-                         const std::string& rootDir):
-        mFile(file),
-        mLine(line),
-        mFunc(func),
-        mMessage(message),
-        mRootDir(rootDir)
+void LoggerScope::enter(const std::string& message)
 {
-    if (logger::Logger::getLogLevel() <= logger::LogLevel::TRACE) {
-        logger::Logger::logMessage(logger::LogLevel::TRACE, "Entering: " + mMessage,
-                                   mFile, mLine, mFunc, mRootDir);
-    }
+    mMessage = message;
+    mIsEntered = true;
+    logger::Logger::logMessage(logger::LogLevel::TRACE, "Entering: " + mMessage,
+                               mFile, mLine, mFunc, mRootDir);
 }
 
-LoggerScope::~LoggerScope()
+void LoggerScope::leave()
 {
-    if (logger::Logger::getLogLevel() <= logger::LogLevel::TRACE) {
-        logger::Logger::logMessage(logger::LogLevel::TRACE, "Leaving:  " + mMessage,
-                                   mFile, mLine, mFunc, mRootDir);
-    }
+    logger::Logger::logMessage(logger::LogLevel::TRACE, "Leaving:  " + mMessage,
+                               mFile, mLine, mFunc, mRootDir);
 }
 
 } // namespace logger
@@ -25,6 +25,8 @@
 #ifndef LOGGER_LOGGER_SCOPE_HPP
 #define LOGGER_LOGGER_SCOPE_HPP
 
+#include "logger/logger.hpp"
+
 #include <string>
 #include <sstream>
 
@@ -49,23 +51,56 @@ private:
 /**
  * Class specifically for scope debug logging. Should be used at the beggining of a scope.
  * Constructor marks scope enterance, destructor marks scope leave.
+ *
+ * Nothing is copied or allocated when tracing is disabled,
+ * the message is made by getMessage() only if the TRACE level is enabled.
  */
 class LoggerScope
 {
 public:
-    LoggerScope(const std::string& file,
+    /**
+     * @param getMessage    callable returning the message as std::string
+     */
+    template<typename MessageFactory>
+    LoggerScope(const char* file,
                 const unsigned int line,
-                const std::string& func,
-                const std::string& message,
-                const std::string& rootDir);
-    ~LoggerScope();
+                const char* func,
+                const char* rootDir,
+                const MessageFactory& getMessage)
+        : mFile(file),
+          mLine(line),
+          mFunc(func),
+          mRootDir(rootDir),
+          mIsEntered(false)
+    {
+        if (__builtin_expect(Logger::isEnabled(LogLevel::TRACE), 0)) {
+            enter(getMessage());
+        }
+    }
+
+    ~LoggerScope()
+    {
+        if (mIsEntered) {
+            leave();
+        }
+    }
+
+    LoggerScope(const LoggerScope&) = delete;
+    LoggerScope& operator=(const LoggerScope&) = delete;
 
 private:
-    const std::string mFile;
+    const char* const mFile;
     const unsigned int mLine;
-    const std::string mFunc;
-    const std::string mMessage;
-    const std::string mRootDir;
+    const char* const mFunc;
+    const char* const mRootDir;
+    bool mIsEntered;
+    std::string mMessage;
+
+    /**
+     * Logs the scope enterance, the destructor will log the leave
+     */
+    void enter(const std::string& message);
+    void leave();
 };
 
 } // namespace logger
@@ -74,10 +109,13 @@ private:
  * @brief Automatically create LoggerScope object which logs at the construction and destruction
  * @ingroup libLogger
  */
-#if !defined(NDEBUG)
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+// One declaration, so LOGS is a single statement and the object lives till the end of the scope
 #define LOGS(MSG)   logger::LoggerScope logScopeObj(__FILE__, __LINE__, __func__,    \
-                                                    logger::SStreamWrapper() << MSG, \
-                                                    PROJECT_SOURCE_DIR)
+                                                    PROJECT_SOURCE_DIR,              \
+                                                    [&]() -> std::string {           \
+                                                        return logger::SStreamWrapper() << MSG; \
+                                                    })
 #else
 #define LOGS(MSG) do {} while (0)
 #endif
@@ -35,12 +35,15 @@ namespace logger {
 
 namespace {
 
-volatile LogLevel gLogLevel = LogLevel::DEBUG;
-std::unique_ptr<LogBackend> gLogBackendPtr(new NullLogger());
+// Accessed only with std::atomic_load and std::atomic_exchange
+std::shared_ptr<LogBackend> gLogBackendPtr(new NullLogger());
+// Serializes the calls of backends that aren't thread safe
 std::mutex gLogMutex;
 
 } // namespace
 
+std::atomic<LogLevel> Logger::sLogLevel(LogLevel::DEBUG);
+
 void setupLogger(const LogType type,
                  const LogLevel level,
                  const std::string &arg)
@@ -81,47 +84,65 @@ void setupLogger(const LogType type,
 
 void Logger::logMessage(LogLevel logLevel,
                         const std::string& message,
-                        const std::string& file,
+                        const char* file,
                         const unsigned int line,
-                        const std::string& func,
-                        const std::string& rootDir)
+                        const char* func,
+                        const char* rootDir)
 {
-    std::string sfile = LogFormatter::stripProjectDir(file, rootDir);
+    const char* sfile = LogFormatter::stripProjectDir(file, rootDir);
+    const std::shared_ptr<LogBackend> backendPtr = std::atomic_load(&gLogBackendPtr);
+    if (backendPtr->isThreadSafe()) {
+        // Don't serialize the logging threads
+        backendPtr->logCallSite(logLevel, sfile, line, func, message);
+        return;
+    }
     std::unique_lock<std::mutex> lock(gLogMutex);
-    gLogBackendPtr->log(logLevel, sfile, line, func, message);
+    backendPtr->logCallSite(logLevel, sfile, line, func, message);
 }
 
 void Logger::logRelog(LogLevel logLevel,
                       const std::istream& stream,
-                      const std::string& file,
+                      const char* file,
                       const unsigned int line,
-                      const std::string& func,
-                      const std::string& rootDir)
+                      const char* func,
+                      const char* rootDir)
 {
-    std::string sfile = LogFormatter::stripProjectDir(file, rootDir);
+    const std::string sfile(LogFormatter::stripProjectDir(file, rootDir));
+    const std::shared_ptr<LogBackend> backendPtr = std::atomic_load(&gLogBackendPtr);
     std::unique_lock<std::mutex> lock(gLogMutex);
-    gLogBackendPtr->relog(logLevel, sfile, line, func, stream);
+    backendPtr->relog(logLevel, sfile, line, func, stream);
+}
+
+void Logger::logSuppressed(LogLevel logLevel,
+                           const unsigned int count,
+                           const char* file,
+                           const unsigned int line,
+                           const char* func,
+                           const char* rootDir)
+{
+    logMessage(logLevel, "Suppressed " + std::to_string(count) + " messages", file, line, func, rootDir);
 }
 
 void Logger::setLogLevel(const LogLevel level)
 {
-    gLogLevel = level;
+    sLogLevel.store(level, std::memory_order_relaxed);
 }
 
 void Logger::setLogLevel(const std::string& level)
 {
-    gLogLevel = parseLogLevel(level);
+    sLogLevel.store(parseLogLevel(level), std::memory_order_relaxed);
 }
 
 LogLevel Logger::getLogLevel(void)
 {
-    return gLogLevel;
+    return sLogLevel.load(std::memory_order_relaxed);
 }
 
 void Logger::setLogBackend(LogBackend* pBackend)
 {
-    std::unique_lock<std::mutex> lock(gLogMutex);
-    gLogBackendPtr.reset(pBackend);
+    std::shared_ptr<LogBackend> oldBackendPtr =
+        std::atomic_exchange(&gLogBackendPtr, std::shared_ptr<LogBackend>(pBackend));
+    // Threads still logging to the old backend keep it alive, the last one destroys it
 }
 
 } // namespace logger
@@ -31,6 +31,9 @@
  * // Set minimal logging level
  * Logger::setLogLevel("TRACE");
  *
+ * // Logs below LOGGER_MIN_LEVEL are removed at compile time, e.g.:
+ * // -DLOGGER_MIN_LEVEL=LOGGER_LEVEL_WARN leaves only LOGE and LOGW
+ *
  *
  * // Set one of the possible backends:
  * Logger::setLogBackend(new NullLogger());
@@ -40,6 +43,12 @@
  * Logger::setLogBackend(new SyslogBackend());
  * Logger::setLogBackend(new StderrBackend());
  *
+ * // Compact binary records, printed with: cargo-log-decoder /tmp/logs.bin
+ * Logger::setLogBackend(new BinaryBackend("/tmp/logs.bin"));
+ *
+ * // Any backend can write from a background thread:
+ * Logger::setLogBackend(new AsyncBackend(new PersistentFileBackend("/tmp/logs.txt")));
+ *
  *
  * // All logs should be visible:
  * LOGE("Error");
@@ -53,6 +62,10 @@
  *     LOGS("Scope");
  * }
  *
+ * // Hot call sites: every 100th message, at most one message per second
+ * LOGW_EVERY_N(100, "Sampled warning");
+ * LOGE_RATELIMIT(1000, "Rate limited error");
+ *
  * @endcode
  */
 
@@ -69,7 +82,11 @@
 #include "logger/backend-persistent-file.hpp"
 #include "logger/backend-syslog.hpp"
 #include "logger/backend-stderr.hpp"
+#include "logger/backend-async.hpp"
+#include "logger/backend-binary.hpp"
+#include "logger/rate-limit.hpp"
 
+#include <atomic>
 #include <sstream>
 #include <string>
 
@@ -106,65 +123,147 @@ class Logger {
 public:
     static void logMessage(LogLevel logLevel,
                            const std::string& message,
-                           const std::string& file,
+                           const char* file,
                            const unsigned int line,
-                           const std::string& func,
-                           const std::string& rootDir);
+                           const char* func,
+                           const char* rootDir);
 
     static void logRelog(LogLevel logLevel,
                          const std::istream& stream,
-                         const std::string& file,
+                         const char* file,
                          const unsigned int line,
-                         const std::string& func,
-                         const std::string& rootDir);
+                         const char* func,
+                         const char* rootDir);
+
+    /**
+     * Logs the summary of the messages suppressed by the rate limit of the call site
+     */
+    static void logSuppressed(LogLevel logLevel,
+                              const unsigned int count,
+                              const char* file,
+                              const unsigned int line,
+                              const char* func,
+                              const char* rootDir);
 
     static void setLogLevel(const LogLevel level);
     static void setLogLevel(const std::string& level);
     static LogLevel getLogLevel(void);
     static void setLogBackend(LogBackend* pBackend);
+
+    /**
+     * Checked by every log statement, compiles to a single load and compare
+     *
+     * @param logLevel  level of the log statement
+     * @return          true if the statement should be logged
+     */
+    static bool isEnabled(const LogLevel logLevel)
+    {
+        return logLevel >= sLogLevel.load(std::memory_order_relaxed);
+    }
+
+private:
+    static std::atomic<LogLevel> sLogLevel;
 };
 
 } // namespace logger
 
 /*@{*/
+/// Formats and logs the message, doesn't check the log level
+#define LOG_MESSAGE(SEVERITY, MESSAGE)                                     \
+    do {                                                                   \
+        std::ostringstream messageStream__;                                \
+        messageStream__ << MESSAGE;                                        \
+        logger::Logger::logMessage(logger::LogLevel::SEVERITY,             \
+                                   messageStream__.str(),                  \
+                                   __FILE__,                               \
+                                   __LINE__,                               \
+                                   __func__,                               \
+                                   PROJECT_SOURCE_DIR);                    \
+    } while (0)
+
 /// Generic logging macro
 #define LOG(SEVERITY, MESSAGE)                                             \
     do {                                                                   \
-        if (logger::Logger::getLogLevel() <= logger::LogLevel::SEVERITY) { \
-            std::ostringstream messageStream__;                            \
-            messageStream__ << MESSAGE;                                    \
-            logger::Logger::logMessage(logger::LogLevel::SEVERITY,         \
-                                       messageStream__.str(),              \
-                                       __FILE__,                           \
-                                       __LINE__,                           \
-                                       __func__,                           \
-                                       PROJECT_SOURCE_DIR);                \
+        if (__builtin_expect(logger::Logger::isEnabled(                    \
+                                 logger::LogLevel::SEVERITY), 0)) {        \
+            LOG_MESSAGE(SEVERITY, MESSAGE);                                \
         }                                                                  \
     } while (0)
 
+/// Logs every N-th message of the call site, starting with the first one
+#define LOG_EVERY_N(SEVERITY, N, MESSAGE)                                  \
+    do {                                                                   \
+        if (__builtin_expect(logger::Logger::isEnabled(                    \
+                                 logger::LogLevel::SEVERITY), 0)) {        \
+            static logger::Sampler sampler__;                              \
+            if (sampler__.tryAcquire(N)) {                                 \
+                LOG_MESSAGE(SEVERITY, MESSAGE);                            \
+            }                                                              \
+        }                                                                  \
+    } while (0)
+
+/// Logs at most one message of the call site per INTERVAL_MS,
+/// the next logged message is preceded by the number of the suppressed ones
+#define LOG_RATELIMIT(SEVERITY, INTERVAL_MS, MESSAGE)                      \
+    do {                                                                   \
+        if (__builtin_expect(logger::Logger::isEnabled(                    \
+                                 logger::LogLevel::SEVERITY), 0)) {        \
+            static logger::RateLimiter rateLimiter__;                      \
+            unsigned int suppressedCount__ = 0;                            \
+            if (rateLimiter__.tryAcquire(INTERVAL_MS, suppressedCount__)) { \
+                if (suppressedCount__ > 0) {                               \
+                    logger::Logger::logSuppressed(logger::LogLevel::SEVERITY, \
+                                                  suppressedCount__,       \
+                                                  __FILE__,                \
+                                                  __LINE__,                \
+                                                  __func__,                \
+                                                  PROJECT_SOURCE_DIR);     \
+                }                                                          \
+                LOG_MESSAGE(SEVERITY, MESSAGE);                            \
+            }                                                              \
+        }                                                                  \
+    } while (0)
 
 /// Logging errors
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
 #define LOGE(MESSAGE) LOG(ERROR, MESSAGE)
+#define LOGE_EVERY_N(N, MESSAGE) LOG_EVERY_N(ERROR, N, MESSAGE)
+#define LOGE_RATELIMIT(INTERVAL_MS, MESSAGE) LOG_RATELIMIT(ERROR, INTERVAL_MS, MESSAGE)
+#else
+#define LOGE(MESSAGE) do {} while (0)
+#define LOGE_EVERY_N(N, MESSAGE) do {} while (0)
+#define LOGE_RATELIMIT(INTERVAL_MS, MESSAGE) do {} while (0)
+#endif
 
 /// Logging warnings
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
 #define LOGW(MESSAGE) LOG(WARN, MESSAGE)
+#define LOGW_EVERY_N(N, MESSAGE) LOG_EVERY_N(WARN, N, MESSAGE)
+#define LOGW_RATELIMIT(INTERVAL_MS, MESSAGE) LOG_RATELIMIT(WARN, INTERVAL_MS, MESSAGE)
+#else
+#define LOGW(MESSAGE) do {} while (0)
+#define LOGW_EVERY_N(N, MESSAGE) do {} while (0)
+#define LOGW_RATELIMIT(INTERVAL_MS, MESSAGE) do {} while (0)
+#endif
 
 /// Logging information
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
 #define LOGI(MESSAGE) LOG(INFO, MESSAGE)
+#define LOGI_EVERY_N(N, MESSAGE) LOG_EVERY_N(INFO, N, MESSAGE)
+#define LOGI_RATELIMIT(INTERVAL_MS, MESSAGE) LOG_RATELIMIT(INFO, INTERVAL_MS, MESSAGE)
+#else
+#define LOGI(MESSAGE) do {} while (0)
+#define LOGI_EVERY_N(N, MESSAGE) do {} while (0)
+#define LOGI_RATELIMIT(INTERVAL_MS, MESSAGE) do {} while (0)
+#endif
 
-#if !defined(NDEBUG)
 /// Logging debug information
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
 #define LOGD(MESSAGE) LOG(DEBUG, MESSAGE)
 
-/// Logging helper information (for debugging purposes)
-#define LOGH(MESSAGE) LOG(HELP, MESSAGE)
-
-/// Logging tracing information
-#define LOGT(MESSAGE) LOG(TRACE, MESSAGE)
-
 #define RELOG(ISTREAM)                                                     \
     do {                                                                   \
-        if (logger::Logger::getLogLevel() <= logger::LogLevel::DEBUG) {    \
+        if (logger::Logger::isEnabled(logger::LogLevel::DEBUG)) {          \
             logger::Logger::logRelog(logger::LogLevel::DEBUG,              \
                                      ISTREAM,                              \
                                      __FILE__,                             \
@@ -173,14 +272,25 @@ public:
                                      PROJECT_SOURCE_DIR);                  \
         }                                                                  \
     } while (0)
-
 #else
 #define LOGD(MESSAGE) do {} while (0)
-#define LOGH(MESSAGE) do {} while (0)
-#define LOGT(MESSAGE) do {} while (0)
 #define RELOG(ISTREAM) do {} while (0)
 #endif
 
+/// Logging tracing information
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+#define LOGT(MESSAGE) LOG(TRACE, MESSAGE)
+#else
+#define LOGT(MESSAGE) do {} while (0)
+#endif
+
+/// Logging helper information (for debugging purposes)
+#if !defined(NDEBUG)
+#define LOGH(MESSAGE) LOG(HELP, MESSAGE)
+#else
+#define LOGH(MESSAGE) do {} while (0)
+#endif
+
 #endif // LOGGER_LOGGER_HPP
 
 /*@}*/
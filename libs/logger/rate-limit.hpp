@@ -0,0 +1,106 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Per call site state of the rate limited and sampled logs
+ */
+
+#ifndef LOGGER_RATE_LIMIT_HPP
+#define LOGGER_RATE_LIMIT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace logger {
+
+/**
+ * Lets one message per interval through, counts the others.
+ *
+ * Lock free. The constructor is constexpr, so a function's static RateLimiter
+ * is initialized at compile time, without the guard of the local statics.
+ */
+class RateLimiter {
+public:
+    constexpr RateLimiter()
+        : mNextAllowedNS(0),
+          mSuppressedCount(0)
+    {
+    }
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @param intervalMS        minimal time between the logged messages
+     * @param suppressedCount   set to the number of messages suppressed since the last logged one
+     * @return                  true if the message should be logged
+     */
+    bool tryAcquire(const unsigned int intervalMS, unsigned int& suppressedCount)
+    {
+        const std::uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        std::uint64_t nextAllowed = mNextAllowedNS.load(std::memory_order_relaxed);
+        if (now < nextAllowed ||
+            !mNextAllowedNS.compare_exchange_strong(nextAllowed,
+                                                    now + intervalMS * 1000000ULL,
+                                                    std::memory_order_relaxed)) {
+            mSuppressedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        suppressedCount = mSuppressedCount.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    std::atomic<std::uint64_t> mNextAllowedNS;
+    std::atomic<unsigned int> mSuppressedCount;
+};
+
+/**
+ * Lets every n-th message through, starting with the first one.
+ * n == 0 lets nothing through.
+ */
+class Sampler {
+public:
+    constexpr Sampler()
+        : mCount(0)
+    {
+    }
+
+    Sampler(const Sampler&) = delete;
+    Sampler& operator=(const Sampler&) = delete;
+
+    bool tryAcquire(const unsigned int n)
+    {
+        if (n == 0) {
+            return false;
+        }
+        return mCount.fetch_add(1, std::memory_order_relaxed) % n == 0;
+    }
+
+private:
+    std::atomic<unsigned int> mCount;
+};
+
+} // namespace logger
+
+#endif // LOGGER_RATE_LIMIT_HPP
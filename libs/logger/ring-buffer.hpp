@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Bounded lock-free queue with many producers and one consumer
+ */
+
+#ifndef LOGGER_RING_BUFFER_HPP
+#define LOGGER_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace logger {
+
+/**
+ * Bounded multi-producer single-consumer queue.
+ *
+ * Every cell has a sequence number that tells whose turn it is:
+ * a producer claims a cell with a CAS on the enqueue position and publishes the value
+ * by bumping the cell's sequence, the consumer frees the cell by bumping it again.
+ * Neither side takes a lock, a full queue is reported to the producer.
+ *
+ * @tparam T movable type of the elements
+ */
+template<typename T>
+class RingBuffer {
+public:
+    /**
+     * @param capacity number of elements, rounded up to a power of 2
+     */
+    explicit RingBuffer(const size_t capacity)
+        : mMask(roundUp(capacity) - 1),
+          mCells(new Cell[mMask + 1]),
+          mEnqueuePos(0),
+          mDequeuePos(0)
+    {
+        for (size_t i = 0; i <= mMask; ++i) {
+            mCells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /**
+     * Can be called from many threads at once
+     *
+     * @return false if the queue is full, the value is left untouched
+     */
+    bool tryPush(T& value)
+    {
+        Cell* cell;
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &mCells[pos & mMask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Can be called only by one thread at a time
+     *
+     * @return false if the queue is empty
+     */
+    bool tryPop(T& value)
+    {
+        Cell& cell = mCells[mDequeuePos & mMask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(mDequeuePos + 1) < 0) {
+            return false;
+        }
+
+        value = std::move(cell.value);
+        cell.sequence.store(mDequeuePos + mMask + 1, std::memory_order_release);
+        ++mDequeuePos;
+        return true;
+    }
+
+    /**
+     * Called by the consumer
+     */
+    bool isEmpty() const
+    {
+        const Cell& cell = mCells[mDequeuePos & mMask];
+        return cell.sequence.load(std::memory_order_acquire) != mDequeuePos + 1;
+    }
+
+    size_t capacity() const
+    {
+        return mMask + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static size_t roundUp(const size_t capacity)
+    {
+        if (capacity == 0) {
+            throw std::invalid_argument("RingBuffer's capacity has to be positive");
+        }
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    // Keeps the positions of producers and the consumer in different cache lines.
+    // Padding instead of alignas, over-aligned new isn't supported in C++11.
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    const size_t mMask;
+    std::unique_ptr<Cell[]> mCells;
+    char mPadding1[CACHE_LINE_SIZE];
+    std::atomic<size_t> mEnqueuePos;
+    char mPadding2[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+    size_t mDequeuePos;
+};
+
+} // namespace logger
+
+#endif // LOGGER_RING_BUFFER_HPP
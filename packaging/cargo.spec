@@ -82,6 +82,7 @@ The package provides libLogger library.
 %defattr(644,root,root,755)
 %{_libdir}/libLogger.so.0
 %attr(755,root,root) %{_libdir}/libLogger.so.%{version}
+%attr(755,root,root) %{_bindir}/cargo-log-decoder
 
 %package -n libLogger-devel
 Summary:        Development logger library
@@ -223,6 +224,7 @@ The package provides libcargo file descriptor I/O module.
 %files -n libcargo-fd-devel
 %defattr(644,root,root,755)
 %{_libdir}/libcargo-fd.so
+%attr(755,root,root) %{_bindir}/cargo-fd-codegen
 %{_includedir}/cargo-fd
 %{_libdir}/pkgconfig/libcargo-fd.pc
 
@@ -355,6 +357,7 @@ systemctl daemon-reload || :
 %files tests
 %defattr(644,root,root,755)
 %attr(755,root,root) %{_bindir}/cargo-unit-tests
+%attr(755,root,root) %{_bindir}/cargo-benchmarks
 %if !%{without_systemd}
 %attr(755,root,root) %{_bindir}/cargo-socket-test
 %endif
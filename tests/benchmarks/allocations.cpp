@@ -0,0 +1,169 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Global operator new replacement counting the heap allocations
+ *          and malloc wrappers tracking the heap usage, including the C libraries
+ */
+
+#include "config.hpp"
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+#include <malloc.h>
+
+extern "C" {
+
+// glibc implementation of the wrapped functions
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+void __libc_free(void* ptr);
+
+} // extern "C"
+
+namespace {
+
+std::atomic<unsigned long long> gAllocationCount(0);
+
+// Usable size of all the allocated blocks
+std::atomic<long long> gHeapSize(0);
+std::atomic<long long> gHeapPeak(0);
+std::atomic<long long> gHeapPeakBase(0);
+
+void addHeapBlock(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    const long long size = gHeapSize += static_cast<long long>(::malloc_usable_size(ptr));
+    long long peak = gHeapPeak.load(std::memory_order_relaxed);
+    while (size > peak && !gHeapPeak.compare_exchange_weak(peak, size, std::memory_order_relaxed)) {
+    }
+}
+
+void removeHeapBlock(void* ptr)
+{
+    if (ptr) {
+        gHeapSize -= static_cast<long long>(::malloc_usable_size(ptr));
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void* malloc(std::size_t size) noexcept
+{
+    void* ptr = __libc_malloc(size);
+    addHeapBlock(ptr);
+    return ptr;
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept
+{
+    void* ptr = __libc_calloc(count, size);
+    addHeapBlock(ptr);
+    return ptr;
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept
+{
+    removeHeapBlock(ptr);
+    void* newPtr = __libc_realloc(ptr, size);
+    if (!newPtr && size != 0) {
+        // The old block is still there
+        addHeapBlock(ptr);
+    }
+    addHeapBlock(newPtr);
+    return newPtr;
+}
+
+void* memalign(std::size_t alignment, std::size_t size) noexcept
+{
+    void* ptr = __libc_memalign(alignment, size);
+    addHeapBlock(ptr);
+    return ptr;
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+{
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept
+{
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    *ptr = memalign(alignment, size);
+    return *ptr || size == 0 ? 0 : ENOMEM;
+}
+
+void free(void* ptr) noexcept
+{
+    removeHeapBlock(ptr);
+    __libc_free(ptr);
+}
+
+} // extern "C"
+
+void* operator new(std::size_t size)
+{
+    ++gAllocationCount;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+namespace benchmark {
+
+unsigned long long getAllocationCount()
+{
+    return gAllocationCount.load(std::memory_order_relaxed);
+}
+
+void resetHeapPeak()
+{
+    const long long size = gHeapSize.load(std::memory_order_relaxed);
+    gHeapPeakBase.store(size, std::memory_order_relaxed);
+    gHeapPeak.store(size, std::memory_order_relaxed);
+}
+
+unsigned long long getHeapPeak()
+{
+    const long long peak = gHeapPeak.load(std::memory_order_relaxed) -
+                           gHeapPeakBase.load(std::memory_order_relaxed);
+    return peak > 0 ? static_cast<unsigned long long>(peak) : 0;
+}
+
+} // namespace benchmark
@@ -0,0 +1,222 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Minimal benchmark harness
+ */
+
+#include "config.hpp"
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace benchmark {
+
+namespace {
+
+std::map<std::string, Benchmark>& registry()
+{
+    static std::map<std::string, Benchmark> benchmarks;
+    return benchmarks;
+}
+
+std::string quote(const std::string& value)
+{
+    std::string result = "\"";
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+} // namespace
+
+Samples::Samples()
+    : mSorted(true)
+{
+}
+
+void Samples::reserve(const size_t size)
+{
+    mValues.reserve(size);
+}
+
+void Samples::add(const Clock::duration& duration)
+{
+    mValues.push_back(std::chrono::duration<double, std::micro>(duration).count());
+    mSorted = false;
+}
+
+void Samples::add(const Samples& samples)
+{
+    mValues.insert(mValues.end(), samples.mValues.begin(), samples.mValues.end());
+    mSorted = false;
+}
+
+size_t Samples::size() const
+{
+    return mValues.size();
+}
+
+double Samples::percentile(const double percent)
+{
+    if (mValues.empty()) {
+        return 0;
+    }
+    if (!mSorted) {
+        std::sort(mValues.begin(), mValues.end());
+        mSorted = true;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(percent / 100 * mValues.size()));
+    return mValues[rank == 0 ? 0 : std::min(rank, mValues.size()) - 1];
+}
+
+double Samples::mean() const
+{
+    if (mValues.empty()) {
+        return 0;
+    }
+    return std::accumulate(mValues.begin(), mValues.end(), 0.0) / mValues.size();
+}
+
+Report::Report(const std::string& name)
+    : mName(name),
+      mOperations(0),
+      mBytes(0),
+      mSeconds(0)
+{
+}
+
+Report& Report::param(const std::string& key, const std::string& value)
+{
+    mParams[key] = quote(value);
+    return *this;
+}
+
+Report& Report::param(const std::string& key, const unsigned long long value)
+{
+    mParams[key] = std::to_string(value);
+    return *this;
+}
+
+Report& Report::operations(const unsigned long long operations, const Clock::duration& elapsed)
+{
+    mOperations = operations;
+    mSeconds = std::chrono::duration<double>(elapsed).count();
+    return *this;
+}
+
+Report& Report::bytes(const unsigned long long bytes)
+{
+    mBytes = bytes;
+    return *this;
+}
+
+Report& Report::metric(const std::string& key, const double value)
+{
+    mMetrics[key] = value;
+    return *this;
+}
+
+Report& Report::latency(Samples& samples)
+{
+    mLatency = {
+        {"mean", samples.mean()},
+        {"min", samples.percentile(0)},
+        {"p50", samples.percentile(50)},
+        {"p90", samples.percentile(90)},
+        {"p99", samples.percentile(99)},
+        {"p999", samples.percentile(99.9)},
+        {"max", samples.percentile(100)}
+    };
+    return *this;
+}
+
+void Report::print(std::ostream& out) const
+{
+    std::ostringstream line;
+    line << "{\"benchmark\": " << quote(mName);
+
+    line << ", \"params\": {";
+    for (auto it = mParams.begin(); it != mParams.end(); ++it) {
+        line << (it == mParams.begin() ? "" : ", ") << quote(it->first) << ": " << it->second;
+    }
+    line << "}";
+
+    line << ", \"operations\": " << mOperations
+         << ", \"seconds\": " << mSeconds
+         << ", \"ops_per_sec\": " << (mSeconds > 0 ? mOperations / mSeconds : 0);
+    if (mBytes) {
+        line << ", \"bytes\": " << mBytes
+             << ", \"bytes_per_sec\": " << (mSeconds > 0 ? mBytes / mSeconds : 0);
+    }
+    for (const auto& metric : mMetrics) {
+        line << ", " << quote(metric.first) << ": " << metric.second;
+    }
+
+    if (!mLatency.empty()) {
+        line << ", \"latency_us\": {";
+        for (auto it = mLatency.begin(); it != mLatency.end(); ++it) {
+            line << (it == mLatency.begin() ? "" : ", ") << quote(it->first) << ": " << it->second;
+        }
+        line << "}";
+    }
+    line << "}";
+
+    out << line.str() << std::endl;
+}
+
+Runner::Runner(std::ostream& out, const double scale)
+    : mOut(out),
+      mScale(scale)
+{
+}
+
+unsigned int Runner::scaled(const unsigned int count) const
+{
+    return std::max(1u, static_cast<unsigned int>(count * mScale));
+}
+
+void Runner::report(const Report& report)
+{
+    report.print(mOut);
+}
+
+Registrar::Registrar(const std::string& name, const Benchmark& benchmark)
+{
+    if (!registry().emplace(name, benchmark).second) {
+        throw std::logic_error("Benchmark registered twice: " + name);
+    }
+}
+
+const std::map<std::string, Benchmark>& getBenchmarks()
+{
+    return registry();
+}
+
+} // namespace benchmark
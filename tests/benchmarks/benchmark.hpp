@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Minimal benchmark harness
+ *
+ * Every benchmark produces one or more reports. Each report is printed as a single
+ * JSON object per line, so the output can be collected and compared between releases.
+ */
+
+#ifndef BENCHMARKS_BENCHMARK_HPP
+#define BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Collects latency samples and computes their statistics
+ */
+class Samples {
+public:
+    Samples();
+
+    void reserve(const size_t size);
+    void add(const Clock::duration& duration);
+    void add(const Samples& samples);
+
+    size_t size() const;
+
+    /**
+     * @param percent   percentile in range [0, 100]
+     * @return          nearest-rank percentile in microseconds
+     */
+    double percentile(const double percent);
+    double mean() const;
+
+private:
+    std::vector<double> mValues;
+    bool mSorted;
+};
+
+/**
+ * Result of a single benchmark scenario
+ */
+class Report {
+public:
+    explicit Report(const std::string& name);
+
+    Report& param(const std::string& key, const std::string& value);
+    Report& param(const std::string& key, const unsigned long long value);
+
+    /**
+     * @param operations    number of completed operations
+     * @param elapsed       wall time of all operations
+     */
+    Report& operations(const unsigned long long operations, const Clock::duration& elapsed);
+
+    /**
+     * @param bytes         number of payload bytes processed by all operations
+     */
+    Report& bytes(const unsigned long long bytes);
+
+    /**
+     * Adds an arbitrary numeric metric (e.g. allocations per operation)
+     */
+    Report& metric(const std::string& key, const double value);
+
+    Report& latency(Samples& samples);
+
+    void print(std::ostream& out) const;
+
+private:
+    std::string mName;
+    std::map<std::string, std::string> mParams;
+    std::map<std::string, double> mMetrics;
+    unsigned long long mOperations;
+    unsigned long long mBytes;
+    double mSeconds;
+    std::vector<std::pair<std::string, double>> mLatency;
+};
+
+/**
+ * Passed to every benchmark; scales its workload and collects its reports
+ */
+class Runner {
+public:
+    Runner(std::ostream& out, const double scale);
+
+    /**
+     * @param count     default number of iterations
+     * @return          number of iterations adjusted with --scale, never less than 1
+     */
+    unsigned int scaled(const unsigned int count) const;
+
+    void report(const Report& report);
+
+private:
+    std::ostream& mOut;
+    double mScale;
+};
+
+typedef std::function<void(Runner&)> Benchmark;
+
+/**
+ * Adds the benchmark to the global registry, used by the BENCHMARK macro
+ */
+struct Registrar {
+    Registrar(const std::string& name, const Benchmark& benchmark);
+};
+
+/**
+ * @return all registered benchmarks, sorted by name
+ */
+const std::map<std::string, Benchmark>& getBenchmarks();
+
+/**
+ * @return number of heap allocations made by the whole process so far
+ */
+unsigned long long getAllocationCount();
+
+/**
+ * Starts measuring the peak heap usage from the current usage
+ */
+void resetHeapPeak();
+
+/**
+ * @return maximal number of heap bytes in use since resetHeapPeak(), over the usage at that time.
+ *         Unlike getAllocationCount() it includes malloc() calls of the C libraries (e.g. json-c)
+ */
+unsigned long long getHeapPeak();
+
+} // namespace benchmark
+
+/**
+ * Defines and registers a benchmark
+ *
+ * Usage example:
+ * BENCHMARK(ipc_callSync, "ipc.callSync.latency") {
+ *     runner.report(benchmark::Report("ipc.callSync.latency").operations(n, elapsed));
+ * }
+ */
+#define BENCHMARK(ID, NAME)                                                \
+    static void ID(benchmark::Runner& runner);                             \
+    static const benchmark::Registrar ID##Registrar(NAME, ID);             \
+    static void ID(benchmark::Runner& runner)
+
+#endif // BENCHMARKS_BENCHMARK_HPP
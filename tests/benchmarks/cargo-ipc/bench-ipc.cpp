@@ -0,0 +1,477 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Benchmarks of the IPC: latency, throughput, batching, signal fan-out and connection churn
+ */
+
+#include "config.hpp"
+
+#include "benchmark.hpp"
+
+#include "cargo-ipc/service.hpp"
+#include "cargo-ipc/client.hpp"
+#include "cargo-ipc/types.hpp"
+#include "cargo-ipc/result.hpp"
+#include "cargo-ipc/epoll/thread-dispatcher.hpp"
+#include "cargo/fields.hpp"
+#include "utils/latch.hpp"
+#include "utils/scoped-dir.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cargo::ipc;
+using namespace cargo::ipc::epoll;
+using namespace benchmark;
+
+namespace {
+
+const std::string BENCH_DIR = "/tmp/bench-ipc";
+const std::string SOCKET_PATH = BENCH_DIR + "/bench.socket";
+
+const MethodID ECHO_METHOD_ID = 1;
+const MethodID SINK_METHOD_ID = 2;
+const MethodID SIGNAL_ID = 3;
+
+// Generous timeout, a benchmark should fail loudly instead of hanging
+const unsigned int TIMEOUT = 10000 /*ms*/;
+
+// Service accepts at most that many peers
+const unsigned int FANOUT_PEERS = internals::DEFAULT_MAX_NUMBER_OF_PEERS;
+const unsigned int FANOUT_DISPATCHERS = 4;
+
+struct Payload {
+    std::string data;
+
+    Payload() = default;
+    explicit Payload(const size_t size): data(size, 'x') {}
+
+    CARGO_REGISTER
+    (
+        data
+    )
+};
+
+struct Ack {
+    CARGO_REGISTER_EMPTY
+};
+
+HandlerExitCode echoHandler(const PeerID,
+                            std::shared_ptr<Payload>& data,
+                            MethodResult::Pointer methodResult)
+{
+    methodResult->set(data);
+    return HandlerExitCode::SUCCESS;
+}
+
+HandlerExitCode sinkHandler(const PeerID,
+                            std::shared_ptr<Payload>&,
+                            MethodResult::Pointer methodResult)
+{
+    methodResult->setVoid();
+    return HandlerExitCode::SUCCESS;
+}
+
+/**
+ * A started Service with the echo and sink methods, running on its own dispatcher
+ */
+struct Server {
+    utils::ScopedDir mDirGuard;
+    ThreadDispatcher mDispatcher;
+    utils::Latch mConnected;
+    utils::Latch mDisconnected;
+    Service mService;
+
+    Server()
+        : mDirGuard(BENCH_DIR),
+          mService(mDispatcher.getPoll(),
+                   SOCKET_PATH,
+                   [this](const PeerID, const FileDescriptor) { mConnected.set(); },
+                   [this](const PeerID, const FileDescriptor) { mDisconnected.set(); })
+    {
+        mService.setMethodHandler<Payload, Payload>(ECHO_METHOD_ID, echoHandler);
+        mService.setMethodHandler<Ack, Payload>(SINK_METHOD_ID, sinkHandler);
+        mService.start();
+    }
+
+    void waitForPeers(const unsigned int n)
+    {
+        if (!mConnected.waitForN(n, TIMEOUT)) {
+            throw std::runtime_error("Peers did not connect in time");
+        }
+    }
+};
+
+void callSyncLoop(Client& client, const unsigned int count, const size_t payloadSize, Samples& samples)
+{
+    auto data = std::make_shared<Payload>(payloadSize);
+    for (unsigned int i = 0; i < count; ++i) {
+        auto start = Clock::now();
+        client.callSync<Payload, Payload>(ECHO_METHOD_ID, data, TIMEOUT);
+        samples.add(Clock::now() - start);
+    }
+}
+
+} // namespace
+
+
+BENCHMARK(ipcCallSyncLatency, "ipc.callSync.latency")
+{
+    const unsigned int count = runner.scaled(10000);
+    const size_t payloadSize = 16;
+
+    Server server;
+    ThreadDispatcher clientDispatcher;
+    Client client(clientDispatcher.getPoll(), SOCKET_PATH);
+    client.start();
+    server.waitForPeers(1);
+
+    Samples warmup;
+    callSyncLoop(client, std::min(count, 100u), payloadSize, warmup);
+
+    Samples samples;
+    samples.reserve(count);
+    auto start = Clock::now();
+    callSyncLoop(client, count, payloadSize, samples);
+    auto elapsed = Clock::now() - start;
+
+    runner.report(Report("ipc.callSync.latency")
+                  .param("payload", payloadSize)
+                  .operations(count, elapsed)
+                  .bytes(2ull * count * payloadSize)
+                  .latency(samples));
+}
+
+BENCHMARK(ipcCallAsyncThroughput, "ipc.callAsync.throughput")
+{
+    const size_t PAYLOAD_SIZES[] = {16, 256, 4 << 10, 64 << 10, 1 << 20, 16 << 20};
+    // Every payload size moves roughly the same amount of data
+    const unsigned long long BYTES_PER_RUN = 256ull << 20;
+
+    Server server;
+    ThreadDispatcher clientDispatcher;
+    Client client(clientDispatcher.getPoll(), SOCKET_PATH);
+    client.start();
+    server.waitForPeers(1);
+
+    for (const size_t payloadSize : PAYLOAD_SIZES) {
+        const unsigned int count = runner.scaled(std::max(16ull, std::min(20000ull, BYTES_PER_RUN / payloadSize)));
+        auto data = std::make_shared<Payload>(payloadSize);
+
+        std::mutex samplesMutex;
+        Samples samples;
+        samples.reserve(count);
+        utils::Latch done;
+
+        auto start = Clock::now();
+        for (unsigned int i = 0; i < count; ++i) {
+            auto sent = Clock::now();
+            client.callAsync<Payload, Ack>(SINK_METHOD_ID, data, [&, sent](Result<Ack>&& result) {
+                auto received = Clock::now();
+                if (result.isValid()) {
+                    std::lock_guard<std::mutex> lock(samplesMutex);
+                    samples.add(received - sent);
+                }
+                done.set();
+            });
+        }
+        if (!done.waitForN(count, TIMEOUT * 6)) {
+            throw std::runtime_error("Asynchronous calls did not finish in time");
+        }
+        auto elapsed = Clock::now() - start;
+
+        std::lock_guard<std::mutex> lock(samplesMutex);
+        runner.report(Report("ipc.callAsync.throughput")
+                      .param("payload", payloadSize)
+                      .operations(samples.size(), elapsed)
+                      .bytes(static_cast<unsigned long long>(samples.size()) * payloadSize)
+                      .metric("failed", count - samples.size())
+                      .latency(samples));
+    }
+}
+
+BENCHMARK(ipcSignalFanout, "ipc.signal.fanout")
+{
+    const unsigned int rounds = runner.scaled(200);
+
+    Server server;
+    std::vector<std::unique_ptr<ThreadDispatcher>> dispatchers;
+    for (unsigned int i = 0; i < FANOUT_DISPATCHERS; ++i) {
+        dispatchers.emplace_back(new ThreadDispatcher());
+    }
+
+    utils::Latch received;
+    auto signalHandler = [&received](const PeerID, std::shared_ptr<Payload>&) {
+        received.set();
+        return HandlerExitCode::SUCCESS;
+    };
+
+    std::vector<std::unique_ptr<Client>> clients;
+    for (unsigned int i = 0; i < FANOUT_PEERS; ++i) {
+        clients.emplace_back(new Client(dispatchers[i % FANOUT_DISPATCHERS]->getPoll(), SOCKET_PATH));
+        clients.back()->setSignalHandler<Payload>(SIGNAL_ID, signalHandler);
+        clients.back()->start();
+    }
+    server.waitForPeers(FANOUT_PEERS);
+
+    // Wait for the signal registrations to propagate to the Service
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    auto data = std::make_shared<Payload>(16);
+    Samples samples;
+    samples.reserve(rounds);
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < rounds; ++i) {
+        auto sent = Clock::now();
+        server.mService.signal<Payload>(SIGNAL_ID, data);
+        if (!received.waitForN(FANOUT_PEERS, TIMEOUT)) {
+            throw std::runtime_error("Signal did not reach all the peers in time");
+        }
+        samples.add(Clock::now() - sent);
+    }
+    auto elapsed = Clock::now() - start;
+
+    runner.report(Report("ipc.signal.fanout")
+                  .param("peers", FANOUT_PEERS)
+                  .param("dispatchers", FANOUT_DISPATCHERS)
+                  .operations(static_cast<unsigned long long>(rounds) * FANOUT_PEERS, elapsed)
+                  .metric("rounds", rounds)
+                  .latency(samples));
+
+    for (auto& client : clients) {
+        client->stop();
+    }
+}
+
+BENCHMARK(ipcConnectChurn, "ipc.connect.churn")
+{
+    const unsigned int count = runner.scaled(500);
+
+    Server server;
+    ThreadDispatcher clientDispatcher;
+
+    Samples connectSamples;
+    Samples cycleSamples;
+    connectSamples.reserve(count);
+    cycleSamples.reserve(count);
+
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < count; ++i) {
+        auto cycleStart = Clock::now();
+        Client client(clientDispatcher.getPoll(), SOCKET_PATH);
+        client.start();
+        server.waitForPeers(1);
+        connectSamples.add(Clock::now() - cycleStart);
+
+        client.stop();
+        if (!server.mDisconnected.wait(TIMEOUT)) {
+            throw std::runtime_error("Peer did not disconnect in time");
+        }
+        cycleSamples.add(Clock::now() - cycleStart);
+    }
+    auto elapsed = Clock::now() - start;
+
+    runner.report(Report("ipc.connect.churn")
+                  .param("phase", "connect")
+                  .operations(count, elapsed)
+                  .latency(connectSamples));
+    runner.report(Report("ipc.connect.churn")
+                  .param("phase", "cycle")
+                  .operations(count, elapsed)
+                  .latency(cycleSamples));
+}
+
+BENCHMARK(ipcCallSyncConcurrent, "ipc.callSync.concurrent")
+{
+    const unsigned int THREADS[] = {1, 2, 4, 8, 16};
+    const unsigned int count = runner.scaled(2000);
+    const size_t payloadSize = 16;
+
+    Server server;
+
+    for (const unsigned int threadCount : THREADS) {
+        std::vector<std::unique_ptr<ThreadDispatcher>> dispatchers;
+        std::vector<std::unique_ptr<Client>> clients;
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            dispatchers.emplace_back(new ThreadDispatcher());
+            clients.emplace_back(new Client(dispatchers.back()->getPoll(), SOCKET_PATH));
+            clients.back()->start();
+        }
+        server.waitForPeers(threadCount);
+
+        std::vector<Samples> threadSamples(threadCount);
+        std::vector<std::exception_ptr> threadErrors(threadCount);
+        std::vector<std::thread> threads;
+        auto start = Clock::now();
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&, i] {
+                try {
+                    threadSamples[i].reserve(count);
+                    callSyncLoop(*clients[i], count, payloadSize, threadSamples[i]);
+                } catch (...) {
+                    threadErrors[i] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto elapsed = Clock::now() - start;
+        for (const auto& error : threadErrors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        Samples samples;
+        for (const Samples& s : threadSamples) {
+            samples.add(s);
+        }
+
+        runner.report(Report("ipc.callSync.concurrent")
+                      .param("threads", threadCount)
+                      .param("payload", payloadSize)
+                      .operations(samples.size(), elapsed)
+                      .latency(samples));
+
+        for (auto& client : clients) {
+            client->stop();
+        }
+        server.mDisconnected.waitForN(threadCount, TIMEOUT);
+    }
+}
+
+BENCHMARK(ipcCallAsyncBatching, "ipc.callAsync.batching")
+{
+    // flushDelayUS of the batching modes, "off" disables batching
+    const std::vector<std::pair<std::string, int>> MODES = {{"off", -1}, {"drain", 0}, {"delay100us", 100}};
+    const unsigned int count = runner.scaled(50000);
+    const size_t payloadSize = 16;
+
+    for (const auto& mode : MODES) {
+        Server server;
+        ThreadDispatcher clientDispatcher;
+        Client client(clientDispatcher.getPoll(), SOCKET_PATH);
+        if (mode.second >= 0) {
+            client.enableBatching(mode.second);
+            server.mService.enableBatching(mode.second);
+        }
+        client.start();
+        server.waitForPeers(1);
+
+        auto data = std::make_shared<Payload>(payloadSize);
+        utils::Latch done;
+        std::atomic<unsigned int> failed(0);
+
+        auto start = Clock::now();
+        for (unsigned int i = 0; i < count; ++i) {
+            client.callAsync<Payload, Ack>(SINK_METHOD_ID, data, [&](Result<Ack>&& result) {
+                if (!result.isValid()) {
+                    ++failed;
+                }
+                done.set();
+            });
+        }
+        if (!done.waitForN(count, TIMEOUT * 6)) {
+            throw std::runtime_error("Asynchronous calls did not finish in time");
+        }
+        auto elapsed = Clock::now() - start;
+
+        runner.report(Report("ipc.callAsync.batching")
+                      .param("batching", mode.first)
+                      .param("payload", payloadSize)
+                      .operations(count, elapsed)
+                      .bytes(static_cast<unsigned long long>(count) * payloadSize)
+                      .metric("failed", failed));
+    }
+}
+
+BENCHMARK(ipcConnectStorm, "ipc.connect.storm")
+{
+    // Many clients reconnecting at once, e.g. after the service restarted
+    const unsigned int PEERS = 400;
+    const unsigned int THREADS = FANOUT_DISPATCHERS;
+    const unsigned int rounds = runner.scaled(10);
+
+    Server server;
+    std::vector<std::unique_ptr<ThreadDispatcher>> dispatchers;
+    for (unsigned int i = 0; i < THREADS; ++i) {
+        dispatchers.emplace_back(new ThreadDispatcher());
+    }
+
+    Samples samples;
+    samples.reserve(rounds);
+    Clock::duration elapsed = Clock::duration::zero();
+    for (unsigned int round = 0; round < rounds; ++round) {
+        std::vector<std::unique_ptr<Client>> clients;
+        for (unsigned int i = 0; i < PEERS; ++i) {
+            clients.emplace_back(new Client(dispatchers[i % THREADS]->getPoll(), SOCKET_PATH));
+        }
+
+        std::vector<std::exception_ptr> threadErrors(THREADS);
+        std::vector<std::thread> threads;
+        auto start = Clock::now();
+        for (unsigned int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&, t] {
+                try {
+                    for (unsigned int i = t; i < PEERS; i += THREADS) {
+                        clients[i]->start();
+                    }
+                } catch (...) {
+                    threadErrors[t] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& error : threadErrors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        server.waitForPeers(PEERS);
+        auto roundElapsed = Clock::now() - start;
+        elapsed += roundElapsed;
+        samples.add(roundElapsed);
+
+        for (auto& client : clients) {
+            client->stop();
+        }
+        if (!server.mDisconnected.waitForN(PEERS, TIMEOUT)) {
+            throw std::runtime_error("Peers did not disconnect in time");
+        }
+    }
+
+    runner.report(Report("ipc.connect.storm")
+                  .param("peers", PEERS)
+                  .param("threads", THREADS)
+                  .operations(static_cast<unsigned long long>(rounds) * PEERS, elapsed)
+                  .metric("rounds", rounds)
+                  .latency(samples));
+}
@@ -0,0 +1,578 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Save/load benchmarks of all the cargo backends on the same structures
+ */
+
+#include "config.hpp"
+
+#include "benchmark.hpp"
+#include "cargo/bench-structures.hpp"
+#include "bench-generated.hpp"
+
+#include "cargo-fd/cargo-fd.hpp"
+#include "cargo-json/cargo-json.hpp"
+#include "cargo-json/internals/to-json-visitor.hpp"
+#include "cargo-sqlite/cargo-sqlite.hpp"
+#include "cargo-gvariant/cargo-gvariant.hpp"
+#include "utils/fd-utils.hpp"
+#include "utils/scoped-dir.hpp"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace benchmark;
+namespace fs = boost::filesystem;
+
+namespace {
+
+const std::string BENCH_DIR = "/tmp/bench-serialization";
+const std::string FD_PATH = BENCH_DIR + "/store.bin";
+const std::string DB_PATH = BENCH_DIR + "/store.db";
+const std::string DB_PREFIX = "bench";
+
+// Number of serialized elements each backend processes per measured phase.
+// KVStore stores every element in a separate row, so it gets a smaller budget.
+const unsigned int ELEMENTS_BUDGET = 200000;
+const unsigned int KVSTORE_ELEMENTS_BUDGET = 1000;
+
+const size_t KVSTORE_COMPRESSION_THRESHOLD = 256;
+
+const unsigned int SMALL_SIZE = 16;
+const unsigned int LARGE_SIZE = 1024;
+
+// About 5MB of json
+const unsigned int JSON_DOCUMENT_SIZE = 16384;
+
+unsigned int getIterations(Runner& runner, const unsigned int budget, const unsigned int elements)
+{
+    return runner.scaled(std::max(1u, budget / std::max(1u, elements)));
+}
+
+/**
+ * Measures the save and the load phase of one backend, reports:
+ * time, output size and heap allocations per operation.
+ *
+ * @param save  saves the structure, returns the size of the serialized data
+ * @param load  fills the structure from the data written by the last save
+ */
+template<typename Cargo, typename Save, typename Load>
+void measure(Runner& runner,
+             const std::string& backend,
+             const std::string& structure,
+             const unsigned int iterations,
+             const Cargo& sample,
+             Save save,
+             Load load)
+{
+    // Warm up and get the output size
+    const size_t size = save(sample);
+
+    Samples saveSamples;
+    saveSamples.reserve(iterations);
+    unsigned long long allocations = getAllocationCount();
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < iterations; ++i) {
+        auto begin = Clock::now();
+        save(sample);
+        saveSamples.add(Clock::now() - begin);
+    }
+    auto elapsed = Clock::now() - start;
+    allocations = getAllocationCount() - allocations;
+
+    runner.report(Report("cargo.save")
+                  .param("backend", backend)
+                  .param("structure", structure)
+                  .operations(iterations, elapsed)
+                  .bytes(static_cast<unsigned long long>(size) * iterations)
+                  .metric("size", size)
+                  .metric("allocations_per_op", static_cast<double>(allocations) / iterations)
+                  .latency(saveSamples));
+
+    Samples loadSamples;
+    loadSamples.reserve(iterations);
+    allocations = getAllocationCount();
+    start = Clock::now();
+    for (unsigned int i = 0; i < iterations; ++i) {
+        auto begin = Clock::now();
+        Cargo loaded;
+        load(loaded);
+        loadSamples.add(Clock::now() - begin);
+    }
+    elapsed = Clock::now() - start;
+    allocations = getAllocationCount() - allocations;
+
+    runner.report(Report("cargo.load")
+                  .param("backend", backend)
+                  .param("structure", structure)
+                  .operations(iterations, elapsed)
+                  .bytes(static_cast<unsigned long long>(size) * iterations)
+                  .metric("size", size)
+                  .metric("allocations_per_op", static_cast<double>(allocations) / iterations)
+                  .latency(loadSamples));
+}
+
+template<typename Cargo>
+void measureFD(Runner& runner,
+               const std::string& structure,
+               const Cargo& sample,
+               const unsigned int elements,
+               const std::string& backend = "fd")
+{
+    int fd = ::open(FD_PATH.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Can't open " + FD_PATH);
+    }
+    std::shared_ptr<void> fdGuard(nullptr, [fd](void*) { utils::close(fd); });
+
+    measure(runner, backend, structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [fd](const Cargo& cargo) {
+                ::lseek(fd, 0, SEEK_SET);
+                cargo::saveToFD(fd, cargo);
+                return static_cast<size_t>(::lseek(fd, 0, SEEK_CUR));
+            },
+            [fd](Cargo& cargo) {
+                ::lseek(fd, 0, SEEK_SET);
+                cargo::loadFromFD(fd, cargo);
+            });
+}
+
+// The tagged format, which peers with different versions of the structures can read
+template<typename Cargo>
+void measureFDTagged(Runner& runner, const std::string& structure, const Cargo& sample, const unsigned int elements)
+{
+    int fd = ::open(FD_PATH.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Can't open " + FD_PATH);
+    }
+    std::shared_ptr<void> fdGuard(nullptr, [fd](void*) { utils::close(fd); });
+
+    measure(runner, "fd-tagged", structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [fd](const Cargo& cargo) {
+                ::lseek(fd, 0, SEEK_SET);
+                cargo::saveToFDTagged(fd, cargo);
+                return static_cast<size_t>(::lseek(fd, 0, SEEK_CUR));
+            },
+            [fd](Cargo& cargo) {
+                ::lseek(fd, 0, SEEK_SET);
+                cargo::loadFromFDTagged(fd, cargo);
+            });
+}
+
+// Integers and sizes as varints
+template<typename Cargo>
+void measureFDCompact(Runner& runner,
+                      const std::string& structure,
+                      const Cargo& sample,
+                      const unsigned int elements,
+                      const cargo::FDCompression compression = cargo::FDCompression::NONE,
+                      const std::string& backend = "fd-compact")
+{
+    int fd = ::open(FD_PATH.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Can't open " + FD_PATH);
+    }
+    std::shared_ptr<void> fdGuard(nullptr, [fd](void*) { utils::close(fd); });
+
+    measure(runner, backend, structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [fd, compression](const Cargo& cargo) {
+                ::lseek(fd, 0, SEEK_SET);
+                cargo::saveToFD(fd, cargo, cargo::FDEncoding::COMPACT, compression);
+                return static_cast<size_t>(::lseek(fd, 0, SEEK_CUR));
+            },
+            [fd](Cargo& cargo) {
+                ::lseek(fd, 0, SEEK_SET);
+                cargo::loadFromFD(fd, cargo, cargo::FDEncoding::COMPACT);
+            });
+}
+
+template<typename Cargo>
+void measureJson(Runner& runner, const std::string& structure, const Cargo& sample, const unsigned int elements)
+{
+    std::string json;
+    measure(runner, "json", structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [&json](const Cargo& cargo) {
+                json = cargo::saveToJsonString(cargo);
+                return json.size();
+            },
+            [&json](Cargo& cargo) {
+                cargo::loadFromJsonString(json, cargo);
+            });
+}
+
+template<typename Cargo>
+void measureJsonStream(Runner& runner, const std::string& structure, const Cargo& sample, const unsigned int elements)
+{
+    std::string json;
+    measure(runner, "json-stream", structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [&json](const Cargo& cargo) {
+                cargo::saveToJsonString(cargo, json);
+                return json.size();
+            },
+            [&json](Cargo& cargo) {
+                cargo::loadFromJsonString(json, cargo, cargo::JsonParser::STREAMING);
+            });
+}
+
+// The json-c object tree, used by saveToJsonString before the streaming writer
+template<typename Cargo>
+void measureJsonTree(Runner& runner, const std::string& structure, const Cargo& sample, const unsigned int elements)
+{
+    std::string json;
+    measure(runner, "json-c", structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [&json](const Cargo& cargo) {
+                cargo::internals::ToJsonVisitor visitor;
+                cargo.accept(visitor);
+                json = visitor.toString();
+                return json.size();
+            },
+            [&json](Cargo& cargo) {
+                cargo::loadFromJsonString(json, cargo);
+            });
+}
+
+template<typename Cargo>
+void measureKVStore(Runner& runner,
+                    const std::string& structure,
+                    const Cargo& sample,
+                    const unsigned int elements,
+                    const size_t compressionThreshold = 0,
+                    const std::string& backend = "sqlite")
+{
+    measure(runner, backend, structure, getIterations(runner, KVSTORE_ELEMENTS_BUDGET, elements), sample,
+            [compressionThreshold](const Cargo& cargo) {
+                cargo::saveToKVStore(DB_PATH, cargo, DB_PREFIX, compressionThreshold);
+                return static_cast<size_t>(fs::file_size(DB_PATH));
+            },
+            [](Cargo& cargo) {
+                cargo::loadFromKVStore(DB_PATH, cargo, DB_PREFIX);
+            });
+}
+
+template<typename Cargo>
+void measureGVariant(Runner& runner, const std::string& structure, const Cargo& sample, const unsigned int elements)
+{
+    std::unique_ptr<GVariant, decltype(&g_variant_unref)> variant(nullptr, g_variant_unref);
+    measure(runner, "gvariant", structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [&variant](const Cargo& cargo) {
+                variant.reset(cargo::saveToGVariant(cargo));
+                return static_cast<size_t>(g_variant_get_size(variant.get()));
+            },
+            [&variant](Cargo& cargo) {
+                cargo::loadFromGVariant(variant.get(), cargo);
+            });
+}
+
+// Loads only the selected fields, the save phase is the same as in measureKVStore
+template<typename Cargo>
+void measureKVStoreFields(Runner& runner,
+                          const std::string& structure,
+                          const Cargo& sample,
+                          const unsigned int elements,
+                          const std::vector<std::string>& paths)
+{
+    measure(runner, "sqlite-fields", structure, getIterations(runner, KVSTORE_ELEMENTS_BUDGET, elements), sample,
+            [](const Cargo& cargo) {
+                cargo::saveToKVStore(DB_PATH, cargo, DB_PREFIX);
+                return static_cast<size_t>(fs::file_size(DB_PATH));
+            },
+            [&paths](Cargo& cargo) {
+                cargo::loadFieldsFromKVStore(DB_PATH, cargo, DB_PREFIX, paths);
+            });
+}
+
+template<typename Cargo>
+void measureJsonFields(Runner& runner,
+                       const std::string& structure,
+                       const Cargo& sample,
+                       const unsigned int elements,
+                       const std::vector<std::string>& paths)
+{
+    std::string json;
+    measure(runner, "json-fields", structure, getIterations(runner, ELEMENTS_BUDGET, elements), sample,
+            [&json](const Cargo& cargo) {
+                cargo::saveToJsonString(cargo, json);
+                return json.size();
+            },
+            [&json, &paths](Cargo& cargo) {
+                cargo::loadFieldsFromJsonString(json, cargo, paths);
+            });
+}
+
+/**
+ * Measures saving the structure to KVStore after a small change,
+ * reports the number of keys written per save next to the time.
+ *
+ * @param change    modifies the structure before each save
+ * @param save      saves the structure, returns the number of written keys
+ */
+template<typename Cargo, typename Change, typename Save>
+void measureKVStoreUpdate(Runner& runner,
+                          const std::string& backend,
+                          const std::string& structure,
+                          const std::string& changeName,
+                          Cargo sample,
+                          Change change,
+                          Save save)
+{
+    fs::remove(DB_PATH);
+    cargo::saveToKVStore(DB_PATH, sample, DB_PREFIX);
+
+    const unsigned int iterations = runner.scaled(20);
+    Samples samples;
+    samples.reserve(iterations);
+    unsigned long long keys = 0;
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < iterations; ++i) {
+        change(sample);
+        auto begin = Clock::now();
+        keys += save(sample);
+        samples.add(Clock::now() - begin);
+    }
+    auto elapsed = Clock::now() - start;
+
+    runner.report(Report("cargo.kvstore.update")
+                  .param("backend", backend)
+                  .param("structure", structure)
+                  .param("change", changeName)
+                  .operations(iterations, elapsed)
+                  .metric("keys_written_per_op", static_cast<double>(keys) / iterations)
+                  .latency(samples));
+}
+
+template<typename Cargo, typename Change>
+void measureKVStoreUpdates(Runner& runner,
+                           const std::string& structure,
+                           const std::string& changeName,
+                           const Cargo& sample,
+                           Change change)
+{
+    // Rewrites all the keys, without the removed elements of the vectors and maps
+    measureKVStoreUpdate(runner, "sqlite", structure, changeName, sample, change,
+                         [](const Cargo& cargo) {
+                             cargo::saveToKVStore(DB_PATH, cargo, DB_PREFIX);
+                             return cargo::internals::KVStore(DB_PATH).getKeys().size();
+                         });
+    measureKVStoreUpdate(runner, "sqlite-changes", structure, changeName, sample, change,
+                         [](const Cargo& cargo) {
+                             return cargo::saveChangesToKVStore(DB_PATH, cargo, DB_PREFIX);
+                         });
+}
+
+/**
+ * @param elements  approximate number of serialized objects, used to scale the number of iterations
+ */
+template<typename Cargo>
+void measureAll(Runner& runner, const std::string& structure, const Cargo& sample, const unsigned int elements)
+{
+    utils::ScopedDir dirGuard(BENCH_DIR);
+
+    measureFD(runner, structure, sample, elements);
+    measureFDTagged(runner, structure, sample, elements);
+    measureFDCompact(runner, structure, sample, elements);
+    measureJson(runner, structure, sample, elements);
+    measureJsonStream(runner, structure, sample, elements);
+    measureJsonTree(runner, structure, sample, elements);
+    measureKVStore(runner, structure, sample, elements);
+    measureGVariant(runner, structure, sample, elements);
+}
+
+} // namespace
+
+
+BENCHMARK(cargoSerializationFlat, "cargo.serialization.flat")
+{
+    measureAll(runner, "flat", makeFlat(1), 1);
+}
+
+BENCHMARK(cargoSerializationNested, "cargo.serialization.nested")
+{
+    measureAll(runner, "nested16", Nested<16>(), 17);
+}
+
+BENCHMARK(cargoSerializationVectors, "cargo.serialization.vectors")
+{
+    for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+        measureAll(runner, "vectors" + std::to_string(size), makeVectors(size), 4 * size);
+    }
+}
+
+BENCHMARK(cargoSerializationMaps, "cargo.serialization.maps")
+{
+    for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+        measureAll(runner, "maps" + std::to_string(size), makeMaps(size), 2 * size);
+    }
+}
+
+BENCHMARK(cargoSerializationUnions, "cargo.serialization.unions")
+{
+    for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+        measureAll(runner, "unions" + std::to_string(size), makeUnions(size), size + 1);
+    }
+}
+
+BENCHMARK(cargoSerializationCodegen, "cargo.serialization.codegen")
+{
+    utils::ScopedDir dirGuard(BENCH_DIR);
+
+    // Same structures and wire format as the "fd" backend, encoded by the code from cargo-fd-codegen
+    measureFD(runner, "flat", makeFlat(1), 1);
+    measureFD(runner, "flat", makeFlat<generated::Flat>(1), 1, "fd-codegen");
+    for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+        const std::string structure = "vectors" + std::to_string(size);
+        measureFD(runner, structure, makeVectors(size), 4 * size);
+        measureFD(runner, structure, makeVectors<generated::Vectors>(size), 4 * size, "fd-codegen");
+    }
+}
+
+// A few fields of a big structure, compared with loading all of it
+BENCHMARK(cargoSerializationFields, "cargo.serialization.fields")
+{
+    utils::ScopedDir dirGuard(BENCH_DIR);
+
+    const std::vector<std::string> paths = {"settings.intVal", "settings.stringVal"};
+    for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+        const std::string structure = "document" + std::to_string(size);
+        const Document document = makeDocument(size);
+        measureJsonStream(runner, structure, document, 4 * size);
+        measureJsonFields(runner, structure, document, 4 * size, paths);
+        measureKVStore(runner, structure, document, 4 * size);
+        measureKVStoreFields(runner, structure, document, 4 * size, paths);
+    }
+}
+
+// Write amplification of saving a big structure after changing one field or appending one element
+BENCHMARK(cargoKVStoreUpdate, "cargo.kvstore.update")
+{
+    utils::ScopedDir dirGuard(BENCH_DIR);
+
+    for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+        const std::string structure = "document" + std::to_string(size);
+        const Document document = makeDocument(size);
+        measureKVStoreUpdates(runner, structure, "field", document,
+                              [](Document& changed) { ++changed.settings.intVal; });
+        measureKVStoreUpdates(runner, structure, "append", document,
+                              [](Document& changed) { changed.data.stringVector.push_back("appended"); });
+    }
+}
+
+// Compression pays off for the big compressible values, the random ones are stored as they are
+BENCHMARK(cargoSerializationCompression, "cargo.serialization.compression")
+{
+    utils::ScopedDir dirGuard(BENCH_DIR);
+
+    for (const bool isCompressible : {true, false}) {
+        for (const unsigned int size : {SMALL_SIZE, LARGE_SIZE}) {
+            const std::string structure = (isCompressible ? "text" : "random") + std::to_string(size);
+            const Blob blob = makeBlob(size, isCompressible);
+            measureFDCompact(runner, structure, blob, size);
+            measureFDCompact(runner, structure, blob, size, cargo::FDCompression::LZ4, "fd-compact-lz4");
+            // The size of the db file doesn't drop after smaller values are saved
+            fs::remove(DB_PATH);
+            measureKVStore(runner, structure, blob, size);
+            fs::remove(DB_PATH);
+            measureKVStore(runner, structure, blob, size, KVSTORE_COMPRESSION_THRESHOLD, "sqlite-lz4");
+        }
+    }
+}
+
+BENCHMARK(cargoFDRoundTrip, "cargo.fd.roundtrip")
+{
+    utils::ScopedDir dirGuard(BENCH_DIR);
+
+    int fd = ::open(FD_PATH.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Can't open " + FD_PATH);
+    }
+    std::shared_ptr<void> fdGuard(nullptr, [fd](void*) { utils::close(fd); });
+
+    // Field names are passed to the visitors without building strings,
+    // so a structure without dynamic members is saved and loaded without allocations
+    const Record sample = makeRecord(1);
+    Record loaded;
+    const unsigned int iterations = runner.scaled(ELEMENTS_BUDGET);
+
+    Samples samples;
+    samples.reserve(iterations);
+    const unsigned long long allocations = getAllocationCount();
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < iterations; ++i) {
+        auto begin = Clock::now();
+        ::lseek(fd, 0, SEEK_SET);
+        cargo::saveToFD(fd, sample);
+        ::lseek(fd, 0, SEEK_SET);
+        cargo::loadFromFD(fd, loaded);
+        samples.add(Clock::now() - begin);
+    }
+    auto elapsed = Clock::now() - start;
+    const unsigned long long roundTripAllocations = getAllocationCount() - allocations;
+
+    runner.report(Report("cargo.fd.roundtrip")
+                  .param("structure", "record")
+                  .operations(iterations, elapsed)
+                  .metric("allocations_per_op", static_cast<double>(roundTripAllocations) / iterations)
+                  .latency(samples));
+}
+
+BENCHMARK(cargoJsonLoadMemory, "cargo.json.load")
+{
+    const std::string json = cargo::saveToJsonString(makeVectors(JSON_DOCUMENT_SIZE));
+    const unsigned int iterations = runner.scaled(5);
+
+    for (const cargo::JsonParser parser : {cargo::JsonParser::JSON_C, cargo::JsonParser::STREAMING}) {
+        Samples samples;
+        unsigned long long peak = 0;
+        auto start = Clock::now();
+        for (unsigned int i = 0; i < iterations; ++i) {
+            resetHeapPeak();
+            auto begin = Clock::now();
+            Vectors vectors;
+            cargo::loadFromJsonString(json, vectors, parser);
+            samples.add(Clock::now() - begin);
+            peak = std::max(peak, getHeapPeak());
+        }
+        auto elapsed = Clock::now() - start;
+
+        // The loaded structure itself is a part of the peak
+        resetHeapPeak();
+        {
+            Vectors vectors = makeVectors(JSON_DOCUMENT_SIZE);
+        }
+        const unsigned long long structureSize = getHeapPeak();
+
+        runner.report(Report("cargo.json.load")
+                      .param("parser", parser == cargo::JsonParser::STREAMING ? "streaming" : "json-c")
+                      .param("structure", "vectors" + std::to_string(JSON_DOCUMENT_SIZE))
+                      .operations(iterations, elapsed)
+                      .bytes(static_cast<unsigned long long>(json.size()) * iterations)
+                      .metric("size", json.size())
+                      .metric("heap_peak", peak)
+                      .metric("structure_heap", structureSize)
+                      .metric("heap_peak_per_json_byte", static_cast<double>(peak) / json.size())
+                      .latency(samples));
+    }
+}
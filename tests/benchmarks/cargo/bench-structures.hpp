@@ -0,0 +1,325 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Structures of increasing size used by the serialization benchmarks
+ */
+
+#ifndef BENCHMARKS_CARGO_BENCH_STRUCTURES_HPP
+#define BENCHMARKS_CARGO_BENCH_STRUCTURES_HPP
+
+#include "cargo/fields.hpp"
+#include "cargo/fields-union.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+enum class BenchEnum: int {
+    FIRST = 0,
+    SECOND = 12
+};
+
+/**
+ * Only simple fields, similar to the top of TestConfig
+ */
+struct Flat {
+    std::int8_t int8Val;
+    std::int16_t int16Val;
+    int intVal;
+    std::int64_t int64Val;
+    std::uint8_t uint8Val;
+    std::uint32_t uint32Val;
+    std::uint64_t uint64Val;
+    double doubleVal;
+    bool boolVal;
+    BenchEnum enumVal;
+    std::string stringVal;
+    std::string pathVal;
+
+    CARGO_REGISTER
+    (
+        int8Val,
+        int16Val,
+        intVal,
+        int64Val,
+        uint8Val,
+        uint32Val,
+        uint64Val,
+        doubleVal,
+        boolVal,
+        enumVal,
+        stringVal,
+        pathVal
+    )
+};
+
+/**
+ * Fixed size fields only, with names longer than the small string buffer
+ */
+struct Record {
+    std::uint64_t connectionIdentifier;
+    std::uint64_t messageSequenceNumber;
+    std::int64_t receivedTimestampNs;
+    std::uint32_t payloadSizeInBytes;
+    std::int32_t retransmissionCount;
+    double processingLatencyMs;
+    bool isAcknowledgementRequired;
+    BenchEnum deliveryPriorityLevel;
+
+    CARGO_REGISTER
+    (
+        connectionIdentifier,
+        messageSequenceNumber,
+        receivedTimestampNs,
+        payloadSizeInBytes,
+        retransmissionCount,
+        processingLatencyMs,
+        isAcknowledgementRequired,
+        deliveryPriorityLevel
+    )
+};
+
+/**
+ * Chain of DEPTH sub-objects
+ */
+template<unsigned int DEPTH>
+struct Nested {
+    int intVal = DEPTH;
+    std::string stringVal = "level" + std::to_string(DEPTH);
+    Nested<DEPTH - 1> child;
+
+    CARGO_REGISTER
+    (
+        intVal,
+        stringVal,
+        child
+    )
+};
+
+template<>
+struct Nested<0> {
+    int intVal = 0;
+    std::string stringVal = "leaf";
+
+    CARGO_REGISTER
+    (
+        intVal,
+        stringVal
+    )
+};
+
+struct Vectors {
+    std::vector<int> intVector;
+    std::vector<double> doubleVector;
+    std::vector<std::string> stringVector;
+    std::vector<Flat> flatVector;
+
+    CARGO_REGISTER
+    (
+        intVector,
+        doubleVector,
+        stringVector,
+        flatVector
+    )
+};
+
+struct Maps {
+    std::map<std::string, std::string> stringMap;
+    std::map<std::string, Flat> flatMap;
+
+    CARGO_REGISTER
+    (
+        stringMap,
+        flatMap
+    )
+};
+
+struct FlatOption {
+    CARGO_DECLARE_UNION
+    (
+        Flat,
+        int
+    )
+};
+
+struct Unions {
+    FlatOption single;
+    std::vector<FlatOption> options;
+
+    CARGO_REGISTER
+    (
+        single,
+        options
+    )
+};
+
+/**
+ * Big configuration, daemons often need only a few of its fields
+ */
+struct Document {
+    Flat settings;
+    Vectors data;
+
+    CARGO_REGISTER
+    (
+        settings,
+        data
+    )
+};
+
+/**
+ * Big text and lines, like logs or metadata of container images
+ */
+struct Blob {
+    std::string data;
+    std::vector<std::string> lines;
+
+    CARGO_REGISTER
+    (
+        data,
+        lines
+    )
+};
+
+template<typename FlatType = Flat>
+FlatType makeFlat(const unsigned int seed)
+{
+    typedef decltype(FlatType().enumVal) Enum;
+
+    FlatType flat;
+    flat.int8Val = static_cast<std::int8_t>(seed % 100);
+    flat.int16Val = static_cast<std::int16_t>(seed % 10000);
+    flat.intVal = static_cast<int>(seed) * 7;
+    flat.int64Val = -1234567890123456789LL + seed;
+    flat.uint8Val = static_cast<std::uint8_t>(seed % 200);
+    flat.uint32Val = seed * 13;
+    flat.uint64Val = 1234567890123456789ULL + seed;
+    flat.doubleVal = seed * 0.25;
+    flat.boolVal = seed % 2 == 0;
+    flat.enumVal = seed % 2 == 0 ? Enum::FIRST : Enum::SECOND;
+    flat.stringVal = "value" + std::to_string(seed);
+    flat.pathVal = "/usr/local/lib/" + std::to_string(seed);
+    return flat;
+}
+
+inline Record makeRecord(const unsigned int seed)
+{
+    Record record;
+    record.connectionIdentifier = 1000 + seed;
+    record.messageSequenceNumber = 1234567890123ULL + seed;
+    record.receivedTimestampNs = 1444000000000000000LL + seed;
+    record.payloadSizeInBytes = seed * 64;
+    record.retransmissionCount = static_cast<std::int32_t>(seed % 3);
+    record.processingLatencyMs = seed * 0.125;
+    record.isAcknowledgementRequired = seed % 2 == 0;
+    record.deliveryPriorityLevel = seed % 2 == 0 ? BenchEnum::FIRST : BenchEnum::SECOND;
+    return record;
+}
+
+template<typename VectorsType = Vectors>
+VectorsType makeVectors(const unsigned int size)
+{
+    typedef typename decltype(VectorsType().flatVector)::value_type FlatType;
+
+    VectorsType vectors;
+    for (unsigned int i = 0; i < size; ++i) {
+        vectors.intVector.push_back(static_cast<int>(i));
+        vectors.doubleVector.push_back(i * 0.5);
+        vectors.stringVector.push_back("string" + std::to_string(i));
+        vectors.flatVector.push_back(makeFlat<FlatType>(i));
+    }
+    return vectors;
+}
+
+inline Document makeDocument(const unsigned int size)
+{
+    Document document;
+    document.settings = makeFlat(size);
+    document.data = makeVectors(size);
+    return document;
+}
+
+inline Maps makeMaps(const unsigned int size)
+{
+    Maps maps;
+    for (unsigned int i = 0; i < size; ++i) {
+        maps.stringMap["key" + std::to_string(i)] = "value" + std::to_string(i);
+        maps.flatMap["key" + std::to_string(i)] = makeFlat(i);
+    }
+    return maps;
+}
+
+inline Unions makeUnions(const unsigned int size)
+{
+    Unions unions;
+    unions.single.set(makeFlat(0));
+    for (unsigned int i = 0; i < size; ++i) {
+        unions.options.push_back(FlatOption());
+        if (i % 2 == 0) {
+            unions.options.back().set(makeFlat(i));
+        } else {
+            unions.options.back().set(static_cast<int>(i));
+        }
+    }
+    return unions;
+}
+
+/**
+ * @param size           number of lines, the data has 64 bytes per line
+ * @param isCompressible log-like text or random printable characters
+ */
+inline Blob makeBlob(const unsigned int size, const bool isCompressible)
+{
+    Blob blob;
+    unsigned int random = size;
+    auto nextChar = [&random]() {
+        random = random * 1103515245 + 12345;
+        return static_cast<char>('!' + (random >> 16) % 94);
+    };
+
+    for (unsigned int i = 0; i < size; ++i) {
+        std::string line;
+        if (isCompressible) {
+            line = "2015-10-18_12:00:" + std::to_string(10 + i % 50) + "_container_started_pid=" +
+                   std::to_string(1000 + i % 7);
+        } else {
+            for (unsigned int j = 0; j < 48; ++j) {
+                line.push_back(nextChar());
+            }
+        }
+        blob.lines.push_back(line);
+
+        if (isCompressible) {
+            blob.data += line;
+        }
+        while (blob.data.size() < 64 * (i + 1)) {
+            blob.data.push_back(isCompressible ? '_' : nextChar());
+        }
+    }
+    return blob;
+}
+
+} // namespace benchmark
+
+#endif // BENCHMARKS_CARGO_BENCH_STRUCTURES_HPP
@@ -0,0 +1,278 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Benchmarks of the logger backends
+ */
+
+#include "config.hpp"
+
+#include "benchmark.hpp"
+
+#include "logger/logger.hpp"
+#include "logger/logger-scope.hpp"
+#include "logger/formatter.hpp"
+#include "utils/scoped-dir.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace logger;
+using namespace benchmark;
+
+namespace {
+
+const std::string BENCH_DIR = "/tmp/bench-logger";
+const std::string LOG_PATH = BENCH_DIR + "/log.txt";
+
+const unsigned int THREADS[] = {1, 4, 16};
+
+typedef std::function<LogBackend*()> BackendFactory;
+
+/**
+ * Restores the benchmarks' default logger setup
+ */
+struct LoggerGuard {
+    ~LoggerGuard()
+    {
+        Logger::setLogLevel(LogLevel::ERROR);
+        Logger::setLogBackend(new NullLogger());
+    }
+};
+
+/**
+ * Every thread logs count lines, reports lines per second and the latency of a single LOG call.
+ * The time includes writing out the lines queued by the asynchronous backends.
+ */
+void measureLines(Runner& runner,
+                  const std::string& backendName,
+                  const BackendFactory& factory,
+                  const unsigned int count)
+{
+    LoggerGuard loggerGuard;
+    for (const unsigned int threadCount : THREADS) {
+        utils::ScopedDir dirGuard(BENCH_DIR);
+        Logger::setLogLevel(LogLevel::INFO);
+        Logger::setLogBackend(factory());
+
+        std::vector<Samples> threadSamples(threadCount);
+        std::vector<std::thread> threads;
+        auto start = Clock::now();
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&, i] {
+                threadSamples[i].reserve(count);
+                for (unsigned int j = 0; j < count; ++j) {
+                    auto begin = Clock::now();
+                    LOGI("Benchmark line " << j << " from the thread " << i);
+                    threadSamples[i].add(Clock::now() - begin);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        // Waits for the queued lines
+        Logger::setLogBackend(new NullLogger());
+        auto elapsed = Clock::now() - start;
+
+        Samples samples;
+        for (const Samples& s : threadSamples) {
+            samples.add(s);
+        }
+
+        runner.report(Report("logger.lines")
+                      .param("backend", backendName)
+                      .param("threads", threadCount)
+                      .operations(samples.size(), elapsed)
+                      .latency(samples));
+    }
+}
+
+/**
+ * Runs the statement count times with the logging disabled at runtime,
+ * reports the time and the heap allocations of a single statement.
+ * The time of an empty loop is subtracted, what's left is the cost of the level check.
+ */
+template<typename Statement>
+void measureDisabled(Runner& runner,
+                     const std::string& statementName,
+                     const unsigned int count,
+                     const double loopNS,
+                     Statement statement)
+{
+    unsigned long long allocations = getAllocationCount();
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < count; ++i) {
+        statement(i);
+        // Keeps the compiler from merging the iterations
+        asm volatile("" : : "r"(i) : "memory");
+    }
+    auto elapsed = Clock::now() - start;
+    allocations = getAllocationCount() - allocations;
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / count;
+    runner.report(Report("logger.disabled")
+                  .param("statement", statementName)
+                  .operations(count, elapsed)
+                  .metric("ns_per_op", ns)
+                  .metric("overhead_ns_per_op", ns - loopNS)
+                  .metric("allocations_per_op", static_cast<double>(allocations) / count));
+}
+
+/**
+ * Every thread formats count headers, reports the headers per second and the allocations
+ */
+void measureHeaders(Runner& runner,
+                    const std::string& methodName,
+                    const std::function<void(std::string&)>& format,
+                    const unsigned int count)
+{
+    for (const unsigned int threadCount : THREADS) {
+        std::vector<std::thread> threads;
+        unsigned long long allocations = getAllocationCount();
+        auto start = Clock::now();
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&] {
+                std::string buffer;
+                for (unsigned int j = 0; j < count; ++j) {
+                    buffer.clear();
+                    format(buffer);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto elapsed = Clock::now() - start;
+        allocations = getAllocationCount() - allocations;
+
+        const unsigned long long operations = static_cast<unsigned long long>(count) * threadCount;
+        runner.report(Report("logger.format")
+                      .param("method", methodName)
+                      .param("threads", threadCount)
+                      .operations(operations, elapsed)
+                      .metric("allocations_per_op", static_cast<double>(allocations) / operations));
+    }
+}
+
+double measureLoopNS(const unsigned int count)
+{
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < count; ++i) {
+        asm volatile("" : : "r"(i) : "memory");
+    }
+    auto elapsed = Clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / count;
+}
+
+} // namespace
+
+
+BENCHMARK(loggerDisabled, "logger.disabled")
+{
+    // Statements below LOGGER_MIN_LEVEL are removed by the preprocessor,
+    // this measures the ones that are compiled in, but disabled at runtime
+    LoggerGuard loggerGuard;
+    Logger::setLogLevel(LogLevel::ERROR);
+
+    const unsigned int count = runner.scaled(10000000);
+    const double loopNS = measureLoopNS(count);
+
+    measureDisabled(runner, "LOGI", count, loopNS, [](const unsigned int i) {
+        LOGI("Disabled line " << i << " with a " << std::string("string"));
+    });
+
+    measureDisabled(runner, "LOGD", count, loopNS, [](const unsigned int i) {
+        LOGD("Disabled line " << i << " with a " << std::string("string"));
+    });
+
+    measureDisabled(runner, "LOGS", count, loopNS, [](const unsigned int i) {
+        LOGS("Disabled scope " << i << " with a " << std::string("string"));
+    });
+}
+
+BENCHMARK(loggerFormat, "logger.format")
+{
+    const unsigned int count = runner.scaled(200000);
+    const std::string file = "libs/cargo-ipc/internals/processor.cpp";
+    const std::string func = "handleEvent";
+
+    measureHeaders(runner, "getHeader", [&](std::string& buffer) {
+        buffer.append(LogFormatter::getHeader(LogLevel::INFO, file, 123, func));
+    }, count);
+
+    measureHeaders(runner, "appendHeader", [&](std::string& buffer) {
+        LogFormatter::appendHeader(buffer, LogLevel::INFO, file, 123, func);
+    }, count);
+}
+
+BENCHMARK(loggerLines, "logger.lines")
+{
+    const unsigned int count = runner.scaled(20000);
+
+    measureLines(runner, "null", [] {
+        return new NullLogger();
+    }, count);
+
+    measureLines(runner, "persistent-file", [] {
+        return new PersistentFileBackend(LOG_PATH);
+    }, count);
+
+    measureLines(runner, "file", [] {
+        return new FileBackend(LOG_PATH);
+    }, count);
+
+    measureLines(runner, "file-buffered", [] {
+        return new FileBackend(LOG_PATH, 64 * 1024);
+    }, count);
+
+    measureLines(runner, "file-rotated", [] {
+        return new FileBackend(LOG_PATH, 64 * 1024, 1000, 1024 * 1024, 2);
+    }, count);
+
+    measureLines(runner, "binary", [] {
+        return new BinaryBackend(LOG_PATH);
+    }, count);
+
+    measureLines(runner, "binary-buffered", [] {
+        return new BinaryBackend(LOG_PATH, 64 * 1024);
+    }, count);
+
+    measureLines(runner, "async-file", [] {
+        return new AsyncBackend(new FileBackend(LOG_PATH, 64 * 1024),
+                                8192,
+                                AsyncBackend::OverflowPolicy::BLOCK);
+    }, count);
+
+    measureLines(runner, "async-binary", [] {
+        return new AsyncBackend(new BinaryBackend(LOG_PATH, 64 * 1024),
+                                8192,
+                                AsyncBackend::OverflowPolicy::BLOCK);
+    }, count);
+
+    measureLines(runner, "async-persistent-file", [] {
+        return new AsyncBackend(new PersistentFileBackend(LOG_PATH),
+                                8192,
+                                AsyncBackend::OverflowPolicy::BLOCK);
+    }, count);
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Main file for the benchmarks
+ *
+ * Usage: cargo-benchmarks [--list] [--filter SUBSTRING]... [--scale FACTOR]
+ */
+
+#include "config.hpp"
+
+#include "benchmark.hpp"
+
+#include "logger/logger.hpp"
+#include "logger/backend-null.hpp"
+#include "utils/signal.hpp"
+
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace logger;
+
+namespace {
+
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--list] [--filter SUBSTRING]... [--scale FACTOR]" << std::endl
+              << "Runs the benchmarks and prints one JSON report per line to stdout." << std::endl;
+}
+
+bool isSelected(const std::string& name, const std::vector<std::string>& filters)
+{
+    if (filters.empty()) {
+        return true;
+    }
+    for (const std::string& filter : filters) {
+        if (name.find(filter) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    bool listOnly = false;
+    double scale = 1.0;
+    std::vector<std::string> filters;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--list") == 0) {
+            listOnly = true;
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filters.push_back(argv[++i]);
+        } else if (std::strcmp(argv[i], "--scale") == 0 && i + 1 < argc) {
+            scale = std::stod(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    Logger::setLogLevel(LogLevel::ERROR);
+    Logger::setLogBackend(new NullLogger());
+    utils::signalBlock(SIGPIPE);
+
+    benchmark::Runner runner(std::cout, scale);
+    int status = 0;
+    for (const auto& entry : benchmark::getBenchmarks()) {
+        if (!isSelected(entry.first, filters)) {
+            continue;
+        }
+        if (listOnly) {
+            std::cout << entry.first << std::endl;
+            continue;
+        }
+        try {
+            entry.second(runner);
+        } catch (const std::exception& e) {
+            std::cerr << entry.first << " failed: " << e.what() << std::endl;
+            status = 1;
+        }
+    }
+
+    return status;
+}
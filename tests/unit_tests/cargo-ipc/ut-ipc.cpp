@@ -159,6 +159,29 @@ struct EmptyData {
     CARGO_REGISTER_EMPTY
 };
 
+// Two versions of one message, the second one has an additional field
+struct TaggedDataV1 {
+    int intVal = -1;
+
+    CARGO_REGISTER
+    (
+        intVal
+    )
+    CARGO_FD_TAGGED
+};
+
+struct TaggedDataV2 {
+    int intVal = -1;
+    std::string stringVal = "default";
+
+    CARGO_REGISTER
+    (
+        intVal,
+        stringVal
+    )
+    CARGO_FD_TAGGED
+};
+
 struct ThrowOnAcceptData {
     template<typename Visitor>
     static void accept(Visitor)
@@ -357,6 +380,37 @@ MULTI_FIXTURE_TEST_CASE(ClientStartStop, F, ThreadedFixture, GlibFixture)
     c.stop();
 }
 
+MULTI_FIXTURE_TEST_CASE(ClientStartBeforeService, F, ThreadedFixture, GlibFixture)
+{
+    Client c(F::getPoll(), SOCKET_PATH);
+    auto clientStarted = std::async(std::launch::async, [&c] {
+        c.startWaiting(TIMEOUT);
+        return std::chrono::steady_clock::now();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(SHORT_OPERATION_TIME));
+    auto serviceStarted = std::chrono::steady_clock::now();
+    Service s(F::getPoll(), SOCKET_PATH);
+    s.setMethodHandler<SendData, RecvData>(1, echoCallback);
+    s.start();
+
+    BOOST_REQUIRE(clientStarted.wait_for(std::chrono::milliseconds(TIMEOUT)) == std::future_status::ready);
+    auto latency = clientStarted.get() - serviceStarted;
+    BOOST_TEST_MESSAGE("Client startup latency: "
+                       << std::chrono::duration_cast<std::chrono::microseconds>(latency).count() << " us");
+    BOOST_CHECK(latency < std::chrono::milliseconds(TIMEOUT));
+
+    testEcho(c, 1);
+}
+
+MULTI_FIXTURE_TEST_CASE(ClientStartNoService, F, ThreadedFixture, GlibFixture)
+{
+    Client c(F::getPoll(), SOCKET_PATH);
+    BOOST_CHECK_THROW(c.start(), IPCException);
+    BOOST_CHECK_THROW(c.startWaiting(SHORT_OPERATION_TIME), IPCException);
+    BOOST_CHECK(!c.isStarted());
+}
+
 MULTI_FIXTURE_TEST_CASE(SyncClientToServiceEcho, F, ThreadedFixture, GlibFixture)
 {
     Service s(F::getPoll(), SOCKET_PATH);
@@ -805,6 +859,66 @@ MULTI_FIXTURE_TEST_CASE(FDSendReceive, F, ThreadedFixture, GlibFixture)
     ::close(fdData->fd.value);
 }
 
+MULTI_FIXTURE_TEST_CASE(TaggedDataVersions, F, ThreadedFixture, GlibFixture)
+{
+    auto echoV1 = [](const PeerID, std::shared_ptr<TaggedDataV1>& data, MethodResult::Pointer methodResult) {
+        auto returnData = std::make_shared<TaggedDataV1>();
+        returnData->intVal = data->intVal;
+        methodResult->set(returnData);
+        return HandlerExitCode::SUCCESS;
+    };
+
+    // The Service has the old version of the message
+    Service s(F::getPoll(), SOCKET_PATH);
+    s.setMethodHandler<TaggedDataV1, TaggedDataV1>(1, echoV1);
+
+    Client c(F::getPoll(), SOCKET_PATH);
+    connectPeer(s, c);
+
+    std::shared_ptr<TaggedDataV2> sentData(new TaggedDataV2());
+    sentData->intVal = 34;
+    sentData->stringVal = "unknown to the Service";
+    std::shared_ptr<TaggedDataV2> recvData = c.callSync<TaggedDataV2, TaggedDataV2>(1, sentData, TIMEOUT);
+    BOOST_REQUIRE(recvData);
+    BOOST_CHECK_EQUAL(recvData->intVal, sentData->intVal);
+    BOOST_CHECK_EQUAL(recvData->stringVal, "default");
+}
+
+MULTI_FIXTURE_TEST_CASE(CompressedMessages, F, ThreadedFixture, GlibFixture)
+{
+    auto echo = [](const PeerID, std::shared_ptr<TaggedDataV2>& data, MethodResult::Pointer methodResult) {
+        methodResult->set(data);
+        return HandlerExitCode::SUCCESS;
+    };
+
+    Service s(F::getPoll(), SOCKET_PATH);
+    s.enableCompression();
+    s.setMethodHandler<TaggedDataV2, TaggedDataV2>(1, echo);
+
+    Client c(F::getPoll(), SOCKET_PATH);
+    connectPeer(s, c);
+
+    std::shared_ptr<TaggedDataV2> sentData(new TaggedDataV2());
+    sentData->intVal = 34;
+    for (int i = 0; i < 1000; ++i) {
+        sentData->stringVal += "compressible" + std::to_string(i % 10);
+    }
+
+    // Only the Service compresses, the messages are sent as they are
+    std::shared_ptr<TaggedDataV2> recvData = c.callSync<TaggedDataV2, TaggedDataV2>(1, sentData, TIMEOUT);
+    BOOST_REQUIRE(recvData);
+    BOOST_CHECK_EQUAL(recvData->stringVal, sentData->stringVal);
+
+    // Announced to the connected Service
+    c.enableCompression();
+    for (int i = 0; i < 3; ++i) {
+        recvData = c.callSync<TaggedDataV2, TaggedDataV2>(1, sentData, TIMEOUT);
+        BOOST_REQUIRE(recvData);
+        BOOST_CHECK_EQUAL(recvData->intVal, sentData->intVal);
+        BOOST_CHECK_EQUAL(recvData->stringVal, sentData->stringVal);
+    }
+}
+
 MULTI_FIXTURE_TEST_CASE(OneShotMethodHandler, F, ThreadedFixture, GlibFixture)
 {
     auto methodHandler = [&](const PeerID, std::shared_ptr<EmptyData>&, MethodResult::Pointer methodResult) {
@@ -849,6 +963,97 @@ MULTI_FIXTURE_TEST_CASE(OneShotSignalHandler, F, ThreadedFixture, GlibFixture)
     BOOST_REQUIRE(!s.isHandled(1));
 }
 
+MULTI_FIXTURE_TEST_CASE(BatchingAsyncEcho, F, ThreadedFixture, GlibFixture)
+{
+    const int CALLS = 1000;
+
+    Service s(F::getPoll(), SOCKET_PATH);
+    s.setMethodHandler<SendData, RecvData>(1, echoCallback);
+    s.enableBatching();
+
+    Client c(F::getPoll(), SOCKET_PATH);
+    c.enableBatching(SHORT_OPERATION_TIME * 1000);
+    connectPeer(s, c);
+
+    std::atomic<int> sum(0);
+    Latch latch;
+    for (int i = 0; i < CALLS; ++i) {
+        auto dataBack = [&sum, &latch](Result<RecvData> && r) {
+            sum += r.get()->intVal;
+            latch.set();
+        };
+        c.callAsync<SendData, RecvData>(1, std::make_shared<SendData>(i), dataBack);
+    }
+
+    BOOST_REQUIRE(latch.waitForN(CALLS, TIMEOUT));
+    BOOST_CHECK_EQUAL(sum, CALLS * (CALLS - 1) / 2);
+
+    testEcho(c, 1);
+}
+
+MULTI_FIXTURE_TEST_CASE(BatchingFlush, F, ThreadedFixture, GlibFixture)
+{
+    Service s(F::getPoll(), SOCKET_PATH);
+    s.setMethodHandler<SendData, RecvData>(1, echoCallback);
+
+    Client c(F::getPoll(), SOCKET_PATH);
+    connectPeer(s, c);
+
+    // The frame would wait much longer than the test
+    c.enableBatching(LONG_OPERATION_TIME * 1000 * 10);
+
+    ValueLatch<std::shared_ptr<RecvData>> recvDataLatch;
+    auto dataBack = [&recvDataLatch](Result<RecvData> && r) {
+        recvDataLatch.set(r.get());
+    };
+    c.callAsync<SendData, RecvData>(1, std::make_shared<SendData>(34), dataBack);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(SHORT_OPERATION_TIME));
+    c.flush();
+    BOOST_CHECK_EQUAL(recvDataLatch.get(TIMEOUT)->intVal, 34);
+
+    c.callAsync<SendData, RecvData>(1, std::make_shared<SendData>(56), dataBack);
+    c.disableBatching();
+    BOOST_CHECK_EQUAL(recvDataLatch.get(TIMEOUT)->intVal, 56);
+
+    testEcho(c, 1);
+}
+
+MULTI_FIXTURE_TEST_CASE(BatchingFDSendReceive, F, ThreadedFixture, GlibFixture)
+{
+    const char DATA[] = "Content of the file";
+    {
+        // Fill the file
+        utils::remove(TEST_FILE);
+        std::ofstream file(TEST_FILE);
+        file << DATA;
+        file.close();
+    }
+
+    auto methodHandler = [&](const PeerID, std::shared_ptr<EmptyData>&, MethodResult::Pointer methodResult) {
+        int fd = ::open(TEST_FILE.c_str(), O_RDONLY);
+        auto returnData = std::make_shared<FDData>(fd);
+        methodResult->set(returnData);
+        return HandlerExitCode::SUCCESS;
+    };
+
+    Service s(F::getPoll(), SOCKET_PATH);
+    s.setMethodHandler<FDData, EmptyData>(1, methodHandler);
+    s.enableBatching();
+
+    Client c(F::getPoll(), SOCKET_PATH);
+    connectPeer(s, c);
+
+    std::shared_ptr<EmptyData> sentData(new EmptyData());
+    std::shared_ptr<FDData> fdData = c.callSync<EmptyData, FDData>(1, sentData, TIMEOUT);
+
+    // Use the file descriptor
+    char buffer[sizeof(DATA)];
+    BOOST_REQUIRE(::read(fdData->fd.value, buffer, sizeof(buffer))>0);
+    BOOST_REQUIRE(strncmp(DATA, buffer, strlen(DATA))==0);
+    ::close(fdData->fd.value);
+}
+
 BOOST_AUTO_TEST_CASE(ConnectionLimit)
 {
     const unsigned oldLimit = utils::getMaxFDNumber();
@@ -283,16 +283,16 @@ const std::string jsonTestString =
     "\"uint32Val\": 123456, "
     "\"uint64Val\": 1234567890123456789, "
     "\"stringVal\": \"blah\", "
-    "\"doubleVal\": -1.234000, "
+    "\"doubleVal\": -1.234, "
     "\"boolVal\": true, "
     "\"enumVal\": 12, "
     "\"emptyIntVector\": [ ], "
     "\"intVector\": [ 1, 2, 3 ], "
     "\"stringVector\": [ \"a\", \"b\" ], "
-    "\"doubleVector\": [ 0.000000, 1.000000, 2.000000 ], "
+    "\"doubleVector\": [ 0.0, 1.0, 2.0 ], "
     "\"intArray\": [ 0, 1 ], "
     "\"intIntPair\": [ 8, 9 ], "
-    "\"complexTuple\": [ \"tuple\", [ 54, -1.234000 ] ], "
+    "\"complexTuple\": [ \"tuple\", [ 54, -1.234 ] ], "
     "\"subObjTuple\": [ { \"intVal\": 54321, \"intVector\": [ 1, 2 ], \"subSubObj\": { \"intVal\": 234 } } ], "
     "\"subObjIntPair\": [ { \"intVal\": 54321, \"intVector\": [ 1, 2 ], \"subSubObj\": { \"intVal\": 234 } }, 50 ], "
     "\"subObj\": { \"intVal\": 54321, \"intVector\": [ 1, 2 ], \"subSubObj\": { \"intVal\": 234 } }, "
@@ -29,15 +29,23 @@
 #include "testconfig-example.hpp"
 #include "utils/fs.hpp"
 #include "utils/fd-utils.hpp"
+#include "utils/exception.hpp"
 #include "cargo-gvariant/cargo-gvariant.hpp"
 #include "cargo-fd/cargo-fd.hpp"
 #include "cargo-sqlite/cargo-sqlite.hpp"
 #include "cargo-json/cargo-json.hpp"
+#include "cargo-json/internals/to-json-visitor.hpp"
 #include "cargo-sqlite-json/cargo-sqlite-json.hpp"
 #include "utils/scoped-dir.hpp"
 #include <sys/types.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
 
 namespace {
 
@@ -48,6 +56,7 @@ using namespace cargo::internals;
 const std::string UT_PATH = "/tmp/ut-config/";
 const std::string DB_PATH = UT_PATH + "kvstore.db3";
 const std::string DB_PREFIX = "ut";
+const std::string JSON_PATH = UT_PATH + "config.json";
 
 // Floating point tolerance as a number of rounding errors
 const int TOLERANCE = 1;
@@ -174,6 +183,97 @@ BOOST_AUTO_TEST_CASE(ToJsonString)
     BOOST_CHECK_THROW(saveToJsonString(unionConfig), CargoException);
 }
 
+namespace jsonEscapeTest {
+
+struct EscapeConfig {
+    std::string stringVal;
+    std::vector<std::string> stringVector;
+    std::map<std::string, int> map;
+    std::vector<bool> boolVector;
+    std::int64_t minVal;
+    std::uint64_t maxVal;
+    std::vector<double> doubleVector;
+
+    CARGO_REGISTER
+    (
+        stringVal,
+        stringVector,
+        map,
+        boolVector,
+        minVal,
+        maxVal,
+        doubleVector
+    )
+};
+
+} // namespace jsonEscapeTest
+
+BOOST_AUTO_TEST_CASE(ToJsonStringSameAsJsonC)
+{
+    jsonEscapeTest::EscapeConfig config;
+    config.stringVal = "quote\" backslash\\ slash/ \b\f\n\r\t \x01\x1f\x7f \xc5\xbc";
+    config.stringVector = {"", "a/b"};
+    config.map = {{"key\"1", 1}, {"", -1}};
+    config.boolVector = {true, false};
+    config.minVal = std::numeric_limits<std::int64_t>::min();
+    config.maxVal = INT64_MAX;
+    config.doubleVector = {-0.0, 1e-10, 123456789.125, 1e300};
+
+    ToJsonVisitor visitor;
+    config.accept(visitor);
+    BOOST_CHECK_EQUAL(saveToJsonString(config), visitor.toString());
+
+    std::string out = "previous content";
+    saveToJsonString(config, out);
+    BOOST_CHECK_EQUAL(out, visitor.toString());
+
+    config.maxVal = UINT64_MAX;
+    BOOST_CHECK_THROW(saveToJsonString(config), CargoException);
+}
+
+namespace jsonDoubleTest {
+
+struct DoubleConfig {
+    std::vector<double> doubleVector;
+
+    CARGO_REGISTER
+    (
+        doubleVector
+    )
+};
+
+} // namespace jsonDoubleTest
+
+BOOST_AUTO_TEST_CASE(ToJsonStringDoublesRoundTrip)
+{
+    jsonDoubleTest::DoubleConfig config;
+    config.doubleVector = {1e-10,
+                           -1e-300,
+                           std::numeric_limits<double>::min(),
+                           std::numeric_limits<double>::denorm_min(),
+                           1e300,
+                           std::numeric_limits<double>::max(),
+                           -std::numeric_limits<double>::max(),
+                           0.1,
+                           1.0 / 3,
+                           2.0,
+                           -0.0};
+
+    const std::string out = saveToJsonString(config);
+    BOOST_CHECK(out.find("[ 1e-10, ") != std::string::npos);
+    BOOST_CHECK(out.find(", 2.0, -0.0 ]") != std::string::npos);
+
+    for (const bool isStreaming : {false, true}) {
+        jsonDoubleTest::DoubleConfig outConfig;
+        loadFromJsonString(out, outConfig, isStreaming ? JsonParser::STREAMING : JsonParser::JSON_C);
+        BOOST_REQUIRE_EQUAL(outConfig.doubleVector.size(), config.doubleVector.size());
+        for (size_t i = 0; i < config.doubleVector.size(); ++i) {
+            BOOST_CHECK_EQUAL(outConfig.doubleVector[i], config.doubleVector[i]);
+        }
+        BOOST_CHECK(std::signbit(outConfig.doubleVector.back()));
+    }
+}
+
 namespace loadErrorsTest {
 
 #define DECLARE_CONFIG(name, type) \
@@ -202,71 +302,122 @@ BOOST_AUTO_TEST_CASE(JsonLoadErrors)
 {
     using namespace loadErrorsTest;
 
-    IntConfig config;
-    BOOST_REQUIRE_NO_THROW(loadFromJsonString("{\"field\":1}", config));
-
-    BOOST_CHECK_THROW(loadFromJsonString("", config), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{", config), CargoException); // invalid json
-    BOOST_CHECK_THROW(loadFromJsonString("{}", config), CargoException); // missing field
-
-    // invalid type
-
-    IntConfig intConfig;
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": 1}", intConfig));
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", intConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", intConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", intConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", intConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", intConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1234567890123456789}", intConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": -1234567890123456789}", intConfig), CargoException);
-
-    StringConfig stringConfig;
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", stringConfig), CargoException);
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": \"1\"}", stringConfig));
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", stringConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", stringConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", stringConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", stringConfig), CargoException);
-
-    DoubleConfig doubleConfig;
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", doubleConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", doubleConfig), CargoException);
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": 1.0}", doubleConfig));
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", doubleConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", doubleConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", doubleConfig), CargoException);
-
-    BoolConfig boolConfig;
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", boolConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", boolConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", boolConfig), CargoException);
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": true}", boolConfig));
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", boolConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", boolConfig), CargoException);
-
-    ArrayConfig arrayConfig;
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", arrayConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", arrayConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", arrayConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", arrayConfig), CargoException);
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": []}", arrayConfig));
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", arrayConfig), CargoException);
-
-    ObjectConfig objectConfig;
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", objectConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", objectConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", objectConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", objectConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", objectConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", objectConfig), CargoException);
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": {\"field\": 1}}", objectConfig));
-
-    UnionConfig unionConfig;
-    BOOST_CHECK_THROW(loadFromJsonString("{\"type\": \"long\", \"value\": 1}", unionConfig), CargoException);
-    BOOST_CHECK_THROW(loadFromJsonString("{\"type\": \"int\"}", unionConfig), CargoException);
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"type\": \"int\", \"value\": 1}", unionConfig));
-    BOOST_CHECK_NO_THROW(loadFromJsonString("{\"type\": \"bool\", \"value\": true}", unionConfig));
+    for (const JsonParser parser : {JsonParser::JSON_C, JsonParser::STREAMING}) {
+        IntConfig config;
+        BOOST_REQUIRE_NO_THROW(loadFromJsonString("{\"field\":1}", config, parser));
+
+        BOOST_CHECK_THROW(loadFromJsonString("", config, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{", config, parser), CargoException); // invalid json
+        BOOST_CHECK_THROW(loadFromJsonString("{}", config, parser), CargoException); // missing field
+
+        // invalid type
+
+        IntConfig intConfig;
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": 1}", intConfig, parser));
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", intConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", intConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", intConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", intConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", intConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1234567890123456789}", intConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": -1234567890123456789}", intConfig, parser), CargoException);
+
+        StringConfig stringConfig;
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", stringConfig, parser), CargoException);
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": \"1\"}", stringConfig, parser));
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", stringConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", stringConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", stringConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", stringConfig, parser), CargoException);
+
+        DoubleConfig doubleConfig;
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", doubleConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", doubleConfig, parser), CargoException);
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": 1.0}", doubleConfig, parser));
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", doubleConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", doubleConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", doubleConfig, parser), CargoException);
+
+        BoolConfig boolConfig;
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", boolConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", boolConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", boolConfig, parser), CargoException);
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": true}", boolConfig, parser));
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", boolConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", boolConfig, parser), CargoException);
+
+        ArrayConfig arrayConfig;
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", arrayConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", arrayConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", arrayConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", arrayConfig, parser), CargoException);
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": []}", arrayConfig, parser));
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", arrayConfig, parser), CargoException);
+
+        ObjectConfig objectConfig;
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1}", objectConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": \"1\"}", objectConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": 1.0}", objectConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": true}", objectConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": []}", objectConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"field\": {}}", objectConfig, parser), CargoException);
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"field\": {\"field\": 1}}", objectConfig, parser));
+
+        UnionConfig unionConfig;
+        BOOST_CHECK_THROW(loadFromJsonString("{\"type\": \"long\", \"value\": 1}", unionConfig, parser), CargoException);
+        BOOST_CHECK_THROW(loadFromJsonString("{\"type\": \"int\"}", unionConfig, parser), CargoException);
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"type\": \"int\", \"value\": 1}", unionConfig, parser));
+        BOOST_CHECK_NO_THROW(loadFromJsonString("{\"type\": \"bool\", \"value\": true}", unionConfig, parser));
+    }
+}
+
+namespace jsonStreamTest {
+
+struct StreamConfig {
+    int intVal;
+    std::string stringVal;
+    std::vector<int> intVector;
+    loadErrorsTest::UnionConfig unionVal;
+
+    CARGO_REGISTER
+    (
+        intVal,
+        stringVal,
+        intVector,
+        unionVal
+    )
+};
+
+} // namespace jsonStreamTest
+
+BOOST_AUTO_TEST_CASE(FromJsonStringStreaming)
+{
+    TestConfig testConfig;
+    BOOST_REQUIRE_NO_THROW(loadFromJsonString(jsonTestString, testConfig, JsonParser::STREAMING));
+    BOOST_CHECK_EQUAL(saveToJsonString(testConfig), jsonTestString);
+
+    // Fields in any order, unknown fields, comments and escapes
+    const std::string json =
+        "/* comment */ { \"unknown\": { \"a\": [ 1, { \"b\": null } ] }, "
+        "\"unionVal\": { \"value\": true, \"type\": \"bool\" }, "
+        "\"intVector\": [ 1, 2 ], // comment\n"
+        "\"string\\u0056al\": \"\\u017c\\ud83d\\ude00\\\"\\/\", "
+        "\"intVal\": -5 }";
+
+    for (const JsonParser parser : {JsonParser::JSON_C, JsonParser::STREAMING}) {
+        jsonStreamTest::StreamConfig config;
+        BOOST_REQUIRE_NO_THROW(loadFromJsonString(json, config, parser));
+        BOOST_CHECK_EQUAL(config.intVal, -5);
+        BOOST_CHECK_EQUAL(config.stringVal, "\xc5\xbc\xf0\x9f\x98\x80\"/");
+        BOOST_CHECK(config.intVector == std::vector<int>({1, 2}));
+        BOOST_CHECK(config.unionVal.as<bool>());
+    }
+
+    jsonStreamTest::StreamConfig config;
+    BOOST_CHECK_THROW(loadFromJsonString(json.substr(0, json.size() - 2), config, JsonParser::STREAMING),
+                      CargoException);
+    BOOST_CHECK_THROW(loadFromJsonString(json + " {}", config, JsonParser::STREAMING),
+                      CargoException);
 }
 
 namespace hasVisitableTest {
@@ -318,6 +469,118 @@ BOOST_AUTO_TEST_CASE(HasVisibleInternalHelper)
     BOOST_CHECK(isVisitable<Visitable>());
 }
 
+namespace fieldNameTest {
+
+struct Fields {
+    int first;
+    std::string secondField;
+
+    CARGO_REGISTER
+    (
+        first,
+        secondField
+    )
+};
+
+struct ChildFields : Fields {
+    bool third;
+
+    CARGO_EXTEND(Fields)
+    (
+        third
+    )
+};
+
+struct NameVisitor {
+    std::vector<std::string>* names;
+    std::vector<std::size_t>* indices;
+
+    template<typename T>
+    void visit(const FieldName& name, const T&)
+    {
+        BOOST_CHECK_EQUAL(name.hash(), FieldName::hash(name.data(), name.size()));
+        BOOST_CHECK_EQUAL(name.c_str()[name.size()], '\0');
+        names->push_back(name.str());
+        indices->push_back(name.index());
+    }
+};
+
+// Visitors written for std::string names
+struct StringNameVisitor {
+    std::vector<std::string>* names;
+
+    template<typename T>
+    void visit(const std::string& name, const T&)
+    {
+        names->push_back(name);
+    }
+};
+
+} // namespace fieldNameTest
+
+BOOST_AUTO_TEST_CASE(FieldNames)
+{
+    using namespace fieldNameTest;
+
+    constexpr FieldName name("secondField", 1);
+    static_assert(name.size() == 11, "");
+    static_assert(name.index() == 1, "");
+    static_assert(name.hash() == FieldName::hash("secondField", 11), "");
+    static_assert(FieldName("first").hash() != name.hash(), "");
+    BOOST_CHECK(name == std::string("secondField"));
+    BOOST_CHECK(name != std::string("secondFiel"));
+
+    const ChildFields fields = ChildFields();
+    std::vector<std::string> names;
+    std::vector<std::size_t> indices;
+    fields.accept(NameVisitor{&names, &indices});
+    const std::vector<std::string> expectedNames = {"third", "first", "secondField"};
+    const std::vector<std::size_t> expectedIndices = {0, 0, 1};
+    BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                  expectedNames.begin(), expectedNames.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(),
+                                  expectedIndices.begin(), expectedIndices.end());
+
+    names.clear();
+    fields.accept(StringNameVisitor{&names});
+    BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                  expectedNames.begin(), expectedNames.end());
+}
+
+BOOST_AUTO_TEST_CASE(FieldTables)
+{
+    using namespace fieldNameTest;
+
+    static_assert(TestConfig::getFieldCount() == 29, "");
+    const FieldTable& table = TestConfig::getFieldTable();
+    BOOST_REQUIRE_EQUAL(table.size(), TestConfig::getFieldCount());
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        BOOST_CHECK_EQUAL(table[i].index(), i);
+        BOOST_CHECK_EQUAL(table.find(table[i].str()), i);
+    }
+    BOOST_CHECK_EQUAL(table.find("intVal"), 2);
+    BOOST_CHECK_EQUAL(table.find("missing"), table.size());
+    BOOST_CHECK_EQUAL(table.find(""), table.size());
+    BOOST_CHECK_EQUAL(table.find("intVal2"), table.size());
+
+    // Base class fields follow
+    static_assert(ChildFields::getFieldCount() == 3, "");
+    const FieldTable& childTable = ChildFields::getFieldTable();
+    BOOST_REQUIRE_EQUAL(childTable.size(), 3);
+    BOOST_CHECK_EQUAL(childTable.find("third"), 0);
+    BOOST_CHECK_EQUAL(childTable.find("first"), 1);
+    BOOST_CHECK_EQUAL(childTable.find("secondField"), 2);
+
+    ChildFields fields;
+    std::vector<std::string> names;
+    std::vector<std::size_t> indices;
+    fields.acceptField(childTable.find("secondField"), NameVisitor{&names, &indices});
+    fields.acceptField(childTable.find("third"), NameVisitor{&names, &indices});
+    const std::vector<std::string> expectedNames = {"secondField", "third"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                  expectedNames.begin(), expectedNames.end());
+}
+
 BOOST_AUTO_TEST_CASE(FromToKVStore)
 {
     TestConfig config;
@@ -331,6 +594,94 @@ BOOST_AUTO_TEST_CASE(FromToKVStore)
     BOOST_CHECK_EQUAL(out, jsonTestString);
 }
 
+BOOST_AUTO_TEST_CASE(SaveChangesToKVStore)
+{
+    TestConfig config;
+    loadFromJsonString(jsonTestString, config);
+
+    const size_t keys = saveChangesToKVStore(DB_PATH, config, DB_PREFIX);
+    BOOST_CHECK(keys > 0);
+    BOOST_CHECK_EQUAL(saveChangesToKVStore(DB_PATH, config, DB_PREFIX), 0);
+
+    config.intVal = 1234;
+    BOOST_CHECK_EQUAL(saveChangesToKVStore(DB_PATH, config, DB_PREFIX), 1);
+
+    // Size and the two removed elements
+    config.intVector = {1};
+    BOOST_CHECK_EQUAL(saveChangesToKVStore(DB_PATH, config, DB_PREFIX), 3);
+
+    TestConfig outConfig;
+    loadFromKVStore(DB_PATH, outConfig, DB_PREFIX);
+    BOOST_CHECK_EQUAL(saveToJsonString(outConfig), saveToJsonString(config));
+
+    // The same keys as written by saveToKVStore
+    saveToKVStore(DB_PATH, config, DB_PREFIX);
+    BOOST_CHECK_EQUAL(saveChangesToKVStore(DB_PATH, config, DB_PREFIX), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FromToJsonFile)
+{
+    TestConfig config;
+    loadFromJsonString(jsonTestString, config);
+    saveToJsonFile(JSON_PATH, config);
+
+    for (const JsonParser parser : {JsonParser::JSON_C, JsonParser::STREAMING}) {
+        TestConfig outConfig;
+        loadFromJsonFile(JSON_PATH, outConfig, parser);
+
+        std::string out = saveToJsonString(outConfig);
+        BOOST_CHECK_EQUAL(out, jsonTestString);
+    }
+
+    TestConfig outConfig;
+    loadFromKVStoreWithJsonFile(DB_PATH, JSON_PATH, outConfig, DB_PREFIX);
+    BOOST_CHECK_EQUAL(saveToJsonString(outConfig), jsonTestString);
+
+    BOOST_CHECK_THROW(loadFromJsonFile(UT_PATH + "missing.json", outConfig), UtilsException);
+}
+
+BOOST_AUTO_TEST_CASE(LoadFields)
+{
+    TestConfig config;
+    loadFromJsonString(jsonTestString, config);
+    saveToKVStore(DB_PATH, config, DB_PREFIX);
+    saveToJsonFile(JSON_PATH, config);
+
+    const std::vector<std::string> paths = {"subObj.subSubObj.intVal", "intVector", "subObj.intVal"};
+    std::vector<std::function<void(TestConfig&, const std::vector<std::string>&)>> loaders = {
+        [](TestConfig& outConfig, const std::vector<std::string>& paths) {
+            loadFieldsFromKVStore(DB_PATH, outConfig, DB_PREFIX, paths);
+        },
+        [](TestConfig& outConfig, const std::vector<std::string>& paths) {
+            loadFieldsFromJsonString(jsonTestString, outConfig, paths);
+        },
+        [](TestConfig& outConfig, const std::vector<std::string>& paths) {
+            loadFieldsFromJsonFile(JSON_PATH, outConfig, paths);
+        }
+    };
+
+    for (const auto& loadFields : loaders) {
+        TestConfig outConfig;
+        outConfig.intVal = -1;
+        outConfig.subObj.intVal = -1;
+        outConfig.subObj.subSubObj.intVal = -1;
+        outConfig.subObj.intVector = {-1};
+
+        loadFields(outConfig, paths);
+        BOOST_CHECK_EQUAL(outConfig.subObj.subSubObj.intVal, config.subObj.subSubObj.intVal);
+        BOOST_CHECK(outConfig.intVector == config.intVector);
+        BOOST_CHECK_EQUAL(outConfig.subObj.intVal, config.subObj.intVal);
+        // Not selected
+        BOOST_CHECK_EQUAL(outConfig.intVal, -1);
+        BOOST_CHECK(outConfig.subObj.intVector == std::vector<int>{-1});
+
+        BOOST_CHECK_THROW(loadFields(outConfig, {"missing"}), CargoException);
+        BOOST_CHECK_THROW(loadFields(outConfig, {"subObj.missing"}), CargoException);
+        BOOST_CHECK_THROW(loadFields(outConfig, {"intVal.value"}), CargoException);
+        BOOST_CHECK_THROW(loadFields(outConfig, {"subObj."}), CargoException);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(FromToFD)
 {
     TestConfig config;
@@ -352,6 +703,653 @@ BOOST_AUTO_TEST_CASE(FromToFD)
     BOOST_CHECK(::close(fd) >= 0);
 }
 
+namespace fdPassingTest {
+
+struct FDVector {
+    int intVal;
+    std::vector<cargo::FileDescriptor> fds;
+    std::string stringVal;
+    cargo::FileDescriptor lastFD;
+
+    CARGO_REGISTER
+    (
+        intVal,
+        fds,
+        stringVal,
+        lastFD
+    )
+};
+
+} // namespace fdPassingTest
+
+BOOST_AUTO_TEST_CASE(FromToFDWithFileDescriptors)
+{
+    using namespace fdPassingTest;
+
+    // More than the kernel passes with one sendmsg
+    const size_t FD_COUNT = 300;
+
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+    int pipeFDs[2];
+    BOOST_REQUIRE(::pipe(pipeFDs) == 0);
+
+    // The access mode tells the pipe ends apart
+    FDVector config;
+    config.intVal = 42;
+    for (size_t i = 0; i < FD_COUNT; ++i) {
+        config.fds.push_back(::dup(pipeFDs[i % 3 == 0 ? 1 : 0]));
+    }
+    config.stringVal = "after the file descriptors";
+    config.lastFD = ::dup(pipeFDs[1]);
+
+    // The test
+    saveToFD(sockets[0], config);
+    FDVector outConfig;
+    loadFromFD(sockets[1], outConfig);
+
+    BOOST_CHECK_EQUAL(outConfig.intVal, config.intVal);
+    BOOST_CHECK_EQUAL(outConfig.stringVal, config.stringVal);
+    BOOST_REQUIRE_EQUAL(outConfig.fds.size(), FD_COUNT);
+    for (size_t i = 0; i < FD_COUNT; ++i) {
+        BOOST_CHECK_NE(outConfig.fds[i].value, config.fds[i].value);
+        BOOST_CHECK_EQUAL(::fcntl(outConfig.fds[i].value, F_GETFL) & O_ACCMODE,
+                          ::fcntl(config.fds[i].value, F_GETFL) & O_ACCMODE);
+    }
+    BOOST_CHECK_EQUAL(::fcntl(outConfig.lastFD.value, F_GETFL) & O_ACCMODE, O_WRONLY);
+
+    // Nothing is left in the socket
+    char buf;
+    BOOST_CHECK_EQUAL(::recv(sockets[1], &buf, sizeof(buf), MSG_DONTWAIT), -1);
+
+    // Cleanup
+    for (size_t i = 0; i < FD_COUNT; ++i) {
+        BOOST_CHECK_NO_THROW(utils::close(config.fds[i].value));
+        BOOST_CHECK_NO_THROW(utils::close(outConfig.fds[i].value));
+    }
+    BOOST_CHECK_NO_THROW(utils::close(config.lastFD.value));
+    BOOST_CHECK_NO_THROW(utils::close(outConfig.lastFD.value));
+    BOOST_CHECK_NO_THROW(utils::close(pipeFDs[0]));
+    BOOST_CHECK_NO_THROW(utils::close(pipeFDs[1]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+BOOST_AUTO_TEST_CASE(FromToFDTagged)
+{
+    TestConfig config;
+    loadFromJsonString(jsonTestString, config);
+    // Setup fd
+    std::string fifoPath = UT_PATH + "fdstore";
+    BOOST_CHECK_NO_THROW(utils::mkfifo(fifoPath, S_IWUSR | S_IRUSR));
+    int fd = ::open(fifoPath.c_str(), O_RDWR);
+    BOOST_REQUIRE(fd >= 0);
+
+    // The test
+    saveToFDTagged(fd, config);
+    TestConfig outConfig;
+    loadFromFDTagged(fd, outConfig);
+    std::string out = saveToJsonString(outConfig);
+    BOOST_CHECK_EQUAL(out, jsonTestString);
+
+    // Cleanup
+    BOOST_CHECK(::close(fd) >= 0);
+}
+
+namespace taggedVersionTest {
+
+struct SubV1 {
+    int intVal = 0;
+
+    CARGO_REGISTER
+    (
+        intVal
+    )
+};
+
+struct SubV2 {
+    int intVal = 0;
+    std::string stringVal = "default";
+
+    CARGO_REGISTER
+    (
+        intVal,
+        stringVal
+    )
+};
+
+struct OldVersion {
+    int intVal = 0;
+    SubV1 sub;
+    std::string stringVal;
+
+    CARGO_REGISTER
+    (
+        intVal,
+        sub,
+        stringVal
+    )
+    CARGO_FD_TAGGED
+};
+
+struct NewVersion {
+    int intVal = 0;
+    SubV2 sub;
+    std::string stringVal;
+    std::vector<SubV2> subs;
+    std::map<std::string, std::int64_t> map;
+    double doubleVal = 0.5;
+    std::vector<bool> boolVector;
+
+    CARGO_REGISTER
+    (
+        intVal,
+        sub,
+        stringVal,
+        subs,
+        map,
+        doubleVal,
+        boolVector
+    )
+    CARGO_FD_TAGGED
+};
+
+struct ChangedType {
+    std::string intVal = "default";
+    SubV1 sub;
+
+    CARGO_REGISTER
+    (
+        intVal,
+        sub
+    )
+    CARGO_FD_TAGGED
+};
+
+struct ExtendedV1 : public SubV2 {
+    std::string derivedVal;
+
+    CARGO_EXTEND(SubV2)
+    (
+        derivedVal
+    )
+    CARGO_FD_TAGGED
+};
+
+struct ExtendedV2 : public SubV2 {
+    std::string derivedVal;
+    int newVal = 0;
+
+    CARGO_EXTEND(SubV2)
+    (
+        derivedVal,
+        newVal
+    )
+    CARGO_FD_TAGGED
+};
+
+struct ExtendedTwice : public ExtendedV1 {
+    double doubleVal = 0.5;
+
+    CARGO_EXTEND(ExtendedV1)
+    (
+        doubleVal
+    )
+    CARGO_FD_TAGGED
+};
+
+} // namespace taggedVersionTest
+
+BOOST_AUTO_TEST_CASE(FDTaggedVersions)
+{
+    using namespace taggedVersionTest;
+
+    BOOST_CHECK(isFDTagged<OldVersion>::value);
+    BOOST_CHECK(!isFDTagged<TestConfig>::value);
+
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    NewVersion newVersion;
+    newVersion.intVal = 42;
+    newVersion.sub.intVal = 7;
+    newVersion.sub.stringVal = "unknown to the old version";
+    newVersion.stringVal = "after the sub-object";
+    newVersion.subs.resize(100);
+    newVersion.map["key"] = 1;
+    newVersion.doubleVal = 1.5;
+    newVersion.boolVector = {true, false, true};
+
+    OldVersion oldVersion;
+    oldVersion.intVal = 13;
+    oldVersion.sub.intVal = 8;
+    oldVersion.stringVal = "old";
+
+    // The new fields are skipped
+    saveToFD(sockets[0], newVersion);
+    OldVersion fromNew;
+    loadFromFD(sockets[1], fromNew);
+    BOOST_CHECK_EQUAL(fromNew.intVal, 42);
+    BOOST_CHECK_EQUAL(fromNew.sub.intVal, 7);
+    BOOST_CHECK_EQUAL(fromNew.stringVal, newVersion.stringVal);
+
+    saveToFD(sockets[0], newVersion);
+    NewVersion fromSame;
+    loadFromFD(sockets[1], fromSame);
+    BOOST_CHECK_EQUAL(fromSame.doubleVal, 1.5);
+    BOOST_CHECK(fromSame.boolVector == newVersion.boolVector);
+
+    // The missing fields keep their values
+    saveToFD(sockets[0], oldVersion);
+    NewVersion fromOld;
+    loadFromFD(sockets[1], fromOld);
+    BOOST_CHECK_EQUAL(fromOld.intVal, 13);
+    BOOST_CHECK_EQUAL(fromOld.sub.intVal, 8);
+    BOOST_CHECK_EQUAL(fromOld.sub.stringVal, "default");
+    BOOST_CHECK_EQUAL(fromOld.stringVal, "old");
+    BOOST_CHECK(fromOld.subs.empty());
+    BOOST_CHECK(fromOld.map.empty());
+    BOOST_CHECK_EQUAL(fromOld.doubleVal, 0.5);
+    BOOST_CHECK(fromOld.boolVector.empty());
+
+    // Fields with a different wire type are skipped
+    saveToFD(sockets[0], oldVersion);
+    ChangedType changedType;
+    loadFromFD(sockets[1], changedType);
+    BOOST_CHECK_EQUAL(changedType.intVal, "default");
+    BOOST_CHECK_EQUAL(changedType.sub.intVal, 8);
+
+    // Nothing is left in the socket
+    char buf;
+    BOOST_CHECK_EQUAL(::recv(sockets[1], &buf, sizeof(buf), MSG_DONTWAIT), -1);
+
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+BOOST_AUTO_TEST_CASE(FDTaggedExtended)
+{
+    using namespace taggedVersionTest;
+
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    ExtendedV2 newVersion;
+    newVersion.intVal = 42;
+    newVersion.stringVal = "inherited";
+    newVersion.derivedVal = "derived";
+    newVersion.newVal = 7;
+
+    // A field added to the derived structure doesn't move the inherited ones
+    saveToFD(sockets[0], newVersion);
+    ExtendedV1 fromNew;
+    loadFromFD(sockets[1], fromNew);
+    BOOST_CHECK_EQUAL(fromNew.intVal, 42);
+    BOOST_CHECK_EQUAL(fromNew.stringVal, "inherited");
+    BOOST_CHECK_EQUAL(fromNew.derivedVal, "derived");
+
+    saveToFD(sockets[0], fromNew);
+    ExtendedV2 fromOld;
+    loadFromFD(sockets[1], fromOld);
+    BOOST_CHECK_EQUAL(fromOld.intVal, 42);
+    BOOST_CHECK_EQUAL(fromOld.stringVal, "inherited");
+    BOOST_CHECK_EQUAL(fromOld.derivedVal, "derived");
+    BOOST_CHECK_EQUAL(fromOld.newVal, 0);
+
+    // Two levels of CARGO_EXTEND, the double at the position of newVal is skipped
+    ExtendedTwice twice;
+    twice.intVal = 13;
+    twice.stringVal = "base";
+    twice.derivedVal = "first";
+    twice.doubleVal = 1.5;
+    saveToFD(sockets[0], twice);
+    ExtendedV2 fromTwice;
+    loadFromFD(sockets[1], fromTwice);
+    BOOST_CHECK_EQUAL(fromTwice.intVal, 13);
+    BOOST_CHECK_EQUAL(fromTwice.stringVal, "base");
+    BOOST_CHECK_EQUAL(fromTwice.derivedVal, "first");
+    BOOST_CHECK_EQUAL(fromTwice.newVal, 0);
+
+    saveToFD(sockets[0], twice);
+    ExtendedTwice outTwice;
+    loadFromFD(sockets[1], outTwice);
+    BOOST_CHECK_EQUAL(outTwice.intVal, 13);
+    BOOST_CHECK_EQUAL(outTwice.derivedVal, "first");
+    BOOST_CHECK_EQUAL(outTwice.doubleVal, 1.5);
+
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+BOOST_AUTO_TEST_CASE(ReceivedFDsClosedOnError)
+{
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    // Empty message announcing two descriptors, the chunk carries only one of them
+    const std::uint32_t header[2] = {0, 2};
+    BOOST_REQUIRE(::write(sockets[0], header, sizeof(header)) == sizeof(header));
+
+    std::uint32_t nLeft = 2;
+    struct iovec iov;
+    iov.iov_base = &nLeft;
+    iov.iov_len = sizeof(nLeft);
+    union {
+        struct cmsghdr cmh;
+        char control[CMSG_SPACE(sizeof(int))];
+    } controlUnion;
+    struct msghdr msgh;
+    ::memset(&msgh, 0, sizeof(msgh));
+    msgh.msg_iov = &iov;
+    msgh.msg_iovlen = 1;
+    msgh.msg_control = controlUnion.control;
+    msgh.msg_controllen = sizeof(controlUnion.control);
+    struct cmsghdr* cmhp = CMSG_FIRSTHDR(&msgh);
+    cmhp->cmsg_level = SOL_SOCKET;
+    cmhp->cmsg_type = SCM_RIGHTS;
+    cmhp->cmsg_len = CMSG_LEN(sizeof(int));
+    const int passed = STDIN_FILENO;
+    ::memcpy(CMSG_DATA(cmhp), &passed, sizeof(passed));
+    BOOST_REQUIRE(::sendmsg(sockets[0], &msgh, 0) == sizeof(nLeft));
+
+    const unsigned int fdNumber = utils::getFDNumber();
+    BOOST_CHECK_THROW(internals::ReceivedMessage message(sockets[1]), CargoException);
+    BOOST_CHECK_EQUAL(utils::getFDNumber(), fdNumber);
+
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+BOOST_AUTO_TEST_CASE(ReceivedMessageTooBig)
+{
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    // Only the header is sent, the receiver must not allocate the announced size
+    const std::uint32_t header[2] = {UINT32_MAX, 0};
+    BOOST_REQUIRE(::write(sockets[0], header, sizeof(header)) == sizeof(header));
+    BOOST_CHECK_THROW(internals::ReceivedMessage message(sockets[1]), CargoException);
+
+    // Compressed data announcing a too big original size
+    const std::uint32_t compressed[3] = {sizeof(std::uint32_t),
+                                         internals::MessageBuilder::COMPRESSED_FLAG,
+                                         UINT32_MAX};
+    BOOST_REQUIRE(::write(sockets[0], compressed, sizeof(compressed)) == sizeof(compressed));
+    BOOST_CHECK_THROW(internals::ReceivedMessage message(sockets[1]), CargoException);
+
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+BOOST_AUTO_TEST_CASE(FDTaggedWithFileDescriptors)
+{
+    using namespace fdPassingTest;
+    using namespace taggedVersionTest;
+
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+    int pipeFDs[2];
+    BOOST_REQUIRE(::pipe(pipeFDs) == 0);
+
+    FDVector config;
+    config.intVal = 42;
+    config.fds.push_back(::dup(pipeFDs[0]));
+    config.fds.push_back(::dup(pipeFDs[1]));
+    config.stringVal = "after the file descriptors";
+    config.lastFD = ::dup(pipeFDs[1]);
+
+    saveToFDTagged(sockets[0], config);
+    FDVector outConfig;
+    loadFromFDTagged(sockets[1], outConfig);
+
+    BOOST_CHECK_EQUAL(outConfig.intVal, config.intVal);
+    BOOST_CHECK_EQUAL(outConfig.stringVal, config.stringVal);
+    BOOST_REQUIRE_EQUAL(outConfig.fds.size(), 2);
+    BOOST_CHECK_EQUAL(::fcntl(outConfig.fds[0].value, F_GETFL) & O_ACCMODE, O_RDONLY);
+    BOOST_CHECK_EQUAL(::fcntl(outConfig.fds[1].value, F_GETFL) & O_ACCMODE, O_WRONLY);
+    BOOST_CHECK_EQUAL(::fcntl(outConfig.lastFD.value, F_GETFL) & O_ACCMODE, O_WRONLY);
+
+    // Descriptors of unknown fields are received and closed
+    saveToFDTagged(sockets[0], config);
+    OldVersion withoutFDs;
+    loadFromFDTagged(sockets[1], withoutFDs);
+    BOOST_CHECK_EQUAL(withoutFDs.intVal, config.intVal);
+
+    char buf;
+    BOOST_CHECK_EQUAL(::recv(sockets[1], &buf, sizeof(buf), MSG_DONTWAIT), -1);
+
+    // Cleanup
+    for (size_t i = 0; i < config.fds.size(); ++i) {
+        BOOST_CHECK_NO_THROW(utils::close(config.fds[i].value));
+        BOOST_CHECK_NO_THROW(utils::close(outConfig.fds[i].value));
+    }
+    BOOST_CHECK_NO_THROW(utils::close(config.lastFD.value));
+    BOOST_CHECK_NO_THROW(utils::close(outConfig.lastFD.value));
+    BOOST_CHECK_NO_THROW(utils::close(pipeFDs[0]));
+    BOOST_CHECK_NO_THROW(utils::close(pipeFDs[1]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+BOOST_AUTO_TEST_CASE(FromToFDCompact)
+{
+    TestConfig config;
+    loadFromJsonString(jsonTestString, config);
+    int fd = ::open((UT_PATH + "fdstore").c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IWUSR | S_IRUSR);
+    BOOST_REQUIRE(fd >= 0);
+
+    saveToFD(fd, config);
+    const off_t defaultSize = ::lseek(fd, 0, SEEK_CUR);
+
+    // The test
+    BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+    saveToFD(fd, config, FDEncoding::COMPACT);
+    BOOST_CHECK_LT(::lseek(fd, 0, SEEK_CUR), defaultSize);
+
+    BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+    TestConfig outConfig;
+    loadFromFD(fd, outConfig, FDEncoding::COMPACT);
+    std::string out = saveToJsonString(outConfig);
+    BOOST_CHECK_EQUAL(out, jsonTestString);
+
+    // Cleanup
+    BOOST_CHECK(::close(fd) >= 0);
+}
+
+namespace compactTest {
+
+struct Integers {
+    std::int16_t int16Val;
+    std::int32_t int32Val;
+    std::int64_t int64Min;
+    std::int64_t int64Max;
+    std::uint64_t uint64Max;
+    std::vector<std::int32_t> intVector;
+    std::vector<std::uint64_t> uint64Vector;
+    std::vector<std::int16_t> int16Vector;
+    std::vector<bool> boolVector;
+
+    CARGO_REGISTER
+    (
+        int16Val,
+        int32Val,
+        int64Min,
+        int64Max,
+        uint64Max,
+        intVector,
+        uint64Vector,
+        int16Vector,
+        boolVector
+    )
+};
+
+struct Narrow {
+    std::int16_t value;
+
+    CARGO_REGISTER
+    (
+        value
+    )
+};
+
+struct Wide {
+    std::int32_t value;
+
+    CARGO_REGISTER
+    (
+        value
+    )
+};
+
+} // namespace compactTest
+
+BOOST_AUTO_TEST_CASE(FDCompactIntegers)
+{
+    using namespace compactTest;
+
+    int sockets[2];
+    BOOST_REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    Integers config;
+    config.int16Val = std::numeric_limits<std::int16_t>::min();
+    config.int32Val = -1;
+    config.int64Min = std::numeric_limits<std::int64_t>::min();
+    config.int64Max = std::numeric_limits<std::int64_t>::max();
+    config.uint64Max = std::numeric_limits<std::uint64_t>::max();
+    // Runs of small numbers broken by big ones, the bulk decoding takes 16 bytes at once
+    for (int i = 0; i < 200; ++i) {
+        const bool isBig = i % 23 == 0 || (i > 100 && i % 3 == 0);
+        config.intVector.push_back(isBig ? -i * 100000 : i % 64 - 32);
+        config.uint64Vector.push_back(isBig ? std::numeric_limits<std::uint64_t>::max() - i : i % 100);
+        config.int16Vector.push_back(static_cast<std::int16_t>(isBig ? i * 100 : -(i % 50)));
+        config.boolVector.push_back(isBig);
+    }
+
+    saveToFD(sockets[0], config, FDEncoding::COMPACT);
+    Integers outConfig;
+    loadFromFD(sockets[1], outConfig, FDEncoding::COMPACT);
+
+    BOOST_CHECK_EQUAL(outConfig.int16Val, config.int16Val);
+    BOOST_CHECK_EQUAL(outConfig.int32Val, config.int32Val);
+    BOOST_CHECK_EQUAL(outConfig.int64Min, config.int64Min);
+    BOOST_CHECK_EQUAL(outConfig.int64Max, config.int64Max);
+    BOOST_CHECK_EQUAL(outConfig.uint64Max, config.uint64Max);
+    BOOST_CHECK(outConfig.intVector == config.intVector);
+    BOOST_CHECK(outConfig.uint64Vector == config.uint64Vector);
+    BOOST_CHECK(outConfig.int16Vector == config.int16Vector);
+    BOOST_CHECK(outConfig.boolVector == config.boolVector);
+
+    // The value doesn't fit the field
+    Wide wide;
+    wide.value = 100000;
+    saveToFD(sockets[0], wide, FDEncoding::COMPACT);
+    Narrow narrow;
+    BOOST_CHECK_THROW(loadFromFD(sockets[1], narrow, FDEncoding::COMPACT), CargoException);
+
+    // The 10th byte of a varint carries only the highest bit of 64
+    const char maxVarint[] = "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01";
+    internals::MessageInput maxInput(maxVarint, maxVarint + 10);
+    BOOST_CHECK_EQUAL(internals::compact::getVarint(maxInput), std::numeric_limits<std::uint64_t>::max());
+    const char overflowingVarint[] = "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02";
+    internals::MessageInput overflowingInput(overflowingVarint, overflowingVarint + 10);
+    BOOST_CHECK_THROW(internals::compact::getVarint(overflowingInput), CargoException);
+
+    BOOST_CHECK_NO_THROW(utils::close(sockets[0]));
+    BOOST_CHECK_NO_THROW(utils::close(sockets[1]));
+}
+
+namespace compressionTest {
+
+struct Blob {
+    std::string text;
+    std::vector<std::int32_t> values;
+
+    CARGO_REGISTER
+    (
+        text,
+        values
+    )
+};
+
+Blob makeBlob(const bool isCompressible)
+{
+    Blob blob;
+    unsigned int random = 12345;
+    for (int i = 0; i < 4000; ++i) {
+        random = random * 1103515245 + 12345;
+        blob.text.push_back(isCompressible ? "log_line_"[i % 9] : static_cast<char>('!' + (random >> 16) % 90));
+        blob.values.push_back(isCompressible ? i % 10 : static_cast<std::int32_t>(random));
+    }
+    return blob;
+}
+
+} // namespace compressionTest
+
+BOOST_AUTO_TEST_CASE(FromToFDCompressed)
+{
+    using namespace compressionTest;
+
+    int fd = ::open((UT_PATH + "fdstore").c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IWUSR | S_IRUSR);
+    BOOST_REQUIRE(fd >= 0);
+
+    for (const bool isCompressible : {true, false}) {
+        const Blob blob = makeBlob(isCompressible);
+
+        BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        saveToFD(fd, blob, FDEncoding::COMPACT);
+        const off_t plainSize = ::lseek(fd, 0, SEEK_CUR);
+
+        BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        saveToFD(fd, blob, FDEncoding::COMPACT, FDCompression::LZ4);
+        const off_t compressedSize = ::lseek(fd, 0, SEEK_CUR);
+        if (isCompressible) {
+            BOOST_CHECK_LT(compressedSize * 10, plainSize);
+        } else {
+            // Data that doesn't get smaller is written as is
+            BOOST_CHECK_EQUAL(compressedSize, plainSize);
+        }
+
+        BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        Blob outBlob;
+        loadFromFD(fd, outBlob, FDEncoding::COMPACT);
+        BOOST_CHECK(outBlob.text == blob.text);
+        BOOST_CHECK(outBlob.values == blob.values);
+
+        BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        saveToFDTagged(fd, blob, FDCompression::LZ4);
+        BOOST_REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        Blob outTaggedBlob;
+        loadFromFDTagged(fd, outTaggedBlob);
+        BOOST_CHECK(outTaggedBlob.text == blob.text);
+        BOOST_CHECK(outTaggedBlob.values == blob.values);
+    }
+
+    BOOST_CHECK(::close(fd) >= 0);
+}
+
+BOOST_AUTO_TEST_CASE(KVStoreCompression)
+{
+    using namespace compressionTest;
+
+    const Blob blob = makeBlob(true);
+    saveToKVStore(DB_PATH, blob, DB_PREFIX, 1024);
+    Blob outBlob;
+    loadFromKVStore(DB_PATH, outBlob, DB_PREFIX);
+    BOOST_CHECK(outBlob.text == blob.text);
+    BOOST_CHECK(outBlob.values == blob.values);
+
+    // Compressed values are read without setting the threshold
+    KVStore store(DB_PATH);
+    store.setCompressionThreshold(16);
+    store.set("short", "short value");
+    store.set("long", blob.text);
+    store.set("random", makeBlob(false).text);
+    store.setCompressionThreshold(0);
+    BOOST_CHECK_EQUAL(store.get("short"), "short value");
+    BOOST_CHECK(store.get("long") == blob.text);
+    BOOST_CHECK(store.get("random") == makeBlob(false).text);
+}
+
 BOOST_AUTO_TEST_CASE(FromToInternetFD)
 {
     TestConfig config;
@@ -535,6 +1533,76 @@ BOOST_AUTO_TEST_CASE(ConfigUnion)
     BOOST_CHECK_EQUAL(out, jsonTestString);
 }
 
+namespace unionIndexTest {
+
+// Gets the union type as its position
+struct IndexVisitor {
+    static constexpr bool UNION_INDEX = true;
+
+    std::vector<int>* indices;
+    int index;
+
+    void visit(const FieldName&, std::uint8_t& value)
+    {
+        value = static_cast<std::uint8_t>(index);
+    }
+
+    void visit(const FieldName&, const std::uint8_t& value)
+    {
+        indices->push_back(value);
+    }
+
+    template<typename T>
+    void visit(const FieldName&, const T&)
+    {
+    }
+};
+
+} // namespace unionIndexTest
+
+BOOST_AUTO_TEST_CASE(ConfigUnionStorage)
+{
+    using namespace unionIndexTest;
+
+    TestConfig::SubConfigOption option;
+    BOOST_CHECK(!option.isSet());
+    BOOST_CHECK_THROW(option.as<int>(), CargoException);
+
+    option.set(5);
+    BOOST_CHECK(option.is<int>());
+    BOOST_CHECK(option.is<const int>());
+    BOOST_CHECK(!option.is<long>());
+    BOOST_CHECK_THROW(option.as<TestConfig::SubConfig>(), CargoException);
+
+    TestConfig::SubConfig subConfig;
+    subConfig.intVal = 7;
+    option.set(subConfig);
+    BOOST_CHECK(option.is<TestConfig::SubConfig>());
+    BOOST_CHECK_EQUAL(option.as<TestConfig::SubConfig>().intVal, 7);
+
+    // Copies don't share the option
+    TestConfig::SubConfigOption copy(option);
+    copy.as<TestConfig::SubConfig>().intVal = 8;
+    BOOST_CHECK_EQUAL(option.as<TestConfig::SubConfig>().intVal, 7);
+    copy.set(3);
+    option = copy;
+    BOOST_CHECK_EQUAL(option.as<int>(), 3);
+
+    std::vector<int> indices;
+    const TestConfig::SubConfigOption& constOption = option;
+    constOption.accept(IndexVisitor{&indices, 0});
+    option.set(subConfig);
+    constOption.accept(IndexVisitor{&indices, 0});
+    const std::vector<int> expectedIndices = {1, 0};
+    BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(),
+                                  expectedIndices.begin(), expectedIndices.end());
+
+    option.accept(IndexVisitor{&indices, 1});
+    BOOST_CHECK(option.is<int>());
+    option.accept(IndexVisitor{&indices, 0});
+    BOOST_CHECK(option.is<TestConfig::SubConfig>());
+    BOOST_CHECK_THROW(option.accept(IndexVisitor{&indices, 2}), CargoException);
+}
 
 BOOST_AUTO_TEST_CASE(GVariantVisitor)
 {
@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2026 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ *  Contact: Jan Olszak <j.olszak@samsung.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License
+ */
+/**
+ * @file
+ * @author  Jan Olszak (j.olszak@samsung.com)
+ * @brief   Unit test of the structures generated by cargo-fd-codegen
+ */
+
+#include "config.hpp"
+
+#include "ut.hpp"
+
+#include "codegen-example.hpp"
+#include "cargo-fd/cargo-fd.hpp"
+#include "utils/fd-utils.hpp"
+
+#include <string>
+#include <unistd.h>
+
+using namespace cargo;
+using namespace cargo::internals;
+
+namespace {
+
+// Hand-written copies of the structures in codegen-example.cargo
+namespace handWritten {
+
+enum class Priority : std::int16_t {
+    LOW = -1,
+    HIGH = 7
+};
+
+struct Point {
+    std::int32_t x;
+    double y;
+    Priority priority;
+
+    CARGO_REGISTER
+    (
+        x,
+        y,
+        priority
+    )
+};
+
+struct Empty {
+    CARGO_REGISTER_EMPTY
+};
+
+struct Message {
+    std::uint64_t id;
+    bool isValid;
+    std::string text;
+    Priority priority;
+    Point point;
+    std::vector<std::int32_t> intVector;
+    std::vector<std::string> stringVector;
+    std::vector<Point> pointVector;
+    std::array<std::uint8_t, 4> byteArray;
+    std::array<std::string, 2> stringArray;
+    std::map<std::string, Point> pointMap;
+    Empty empty;
+    std::vector<std::vector<std::int64_t>> nestedVector;
+    std::string lastText;
+
+    CARGO_REGISTER
+    (
+        id,
+        isValid,
+        text,
+        priority,
+        point,
+        intVector,
+        stringVector,
+        pointVector,
+        byteArray,
+        stringArray,
+        pointMap,
+        empty,
+        nestedVector,
+        lastText
+    )
+};
+
+} // namespace handWritten
+
+template<typename Message>
+Message makeMessage(const std::size_t textSize)
+{
+    typedef decltype(Message().point) Point;
+    typedef decltype(Message().priority) Priority;
+
+    Message message;
+    message.id = 1234567890123ULL;
+    message.isValid = true;
+    message.text = std::string(textSize, 't');
+    message.priority = Priority::HIGH;
+    message.point = Point{-3, 0.5, Priority::LOW};
+    message.intVector = {1, -2, 3};
+    message.stringVector = {"", "a", "bc"};
+    message.pointVector = {Point{1, 1.5, Priority::LOW}, Point{2, 2.5, Priority::HIGH}};
+    message.byteArray = {{1, 2, 254, 255}};
+    message.stringArray = {{"first", ""}};
+    message.pointMap["key"] = Point{7, 7.5, Priority::HIGH};
+    message.pointMap[""] = Point{8, 8.5, Priority::LOW};
+    message.nestedVector = {{}, {1}, {-1, 1LL << 40}};
+    message.lastText = "last";
+    return message;
+}
+
+// Everything saved by saveToFD
+template<typename Cargo>
+std::string saveToBytes(const Cargo& visitable)
+{
+    int fds[2];
+    BOOST_REQUIRE(::pipe(fds) == 0);
+    saveToFD(fds[1], visitable);
+    utils::close(fds[1]);
+
+    std::string bytes;
+    char buffer[256];
+    ssize_t size;
+    while ((size = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+        bytes.append(buffer, size);
+    }
+    utils::close(fds[0]);
+    return bytes;
+}
+
+template<typename Cargo>
+void loadFromBytes(const std::string& bytes, Cargo& visitable)
+{
+    int fds[2];
+    BOOST_REQUIRE(::pipe(fds) == 0);
+    utils::write(fds[1], bytes.data(), bytes.size());
+    loadFromFD(fds[0], visitable);
+
+    // Everything was read
+    utils::close(fds[1]);
+    char c;
+    BOOST_CHECK_EQUAL(::read(fds[0], &c, 1), 0);
+    utils::close(fds[0]);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FDCodegenSuite)
+
+BOOST_AUTO_TEST_CASE(HasCodec)
+{
+    BOOST_CHECK(hasFDCodec<codegenTest::Message>::value);
+    BOOST_CHECK(hasFDCodec<codegenTest::Empty>::value);
+    BOOST_CHECK(!hasFDCodec<handWritten::Message>::value);
+}
+
+BOOST_AUTO_TEST_CASE(SameEncoding)
+{
+    // Encoded on the stack and on the heap
+    for (std::size_t textSize : {5, 5000}) {
+        const std::string bytes = saveToBytes(makeMessage<handWritten::Message>(textSize));
+        const codegenTest::Message message = makeMessage<codegenTest::Message>(textSize);
+        BOOST_CHECK_EQUAL(message.getFDSize(), bytes.size());
+        BOOST_CHECK(saveToBytes(message) == bytes);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DecodeHandWritten)
+{
+    const std::string bytes = saveToBytes(makeMessage<handWritten::Message>(5));
+
+    codegenTest::Message message;
+    loadFromBytes(bytes, message);
+    BOOST_CHECK_EQUAL(message.id, 1234567890123ULL);
+    BOOST_CHECK(message.priority == codegenTest::Priority::HIGH);
+    BOOST_CHECK(message.point.priority == codegenTest::Priority::LOW);
+    BOOST_CHECK_EQUAL(message.pointVector.size(), 2);
+    BOOST_CHECK_EQUAL(message.pointMap["key"].y, 7.5);
+    BOOST_CHECK_EQUAL(message.nestedVector[2][1], 1LL << 40);
+    BOOST_CHECK_EQUAL(message.lastText, "last");
+    BOOST_CHECK(saveToBytes(message) == bytes);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeGenerated)
+{
+    const std::string bytes = saveToBytes(makeMessage<codegenTest::Message>(5000));
+
+    handWritten::Message handWrittenMessage;
+    loadFromBytes(bytes, handWrittenMessage);
+    BOOST_CHECK(saveToBytes(handWrittenMessage) == bytes);
+
+    codegenTest::Message message;
+    loadFromBytes(bytes, message);
+    BOOST_CHECK(saveToBytes(message) == bytes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -33,6 +33,7 @@
 #include "utils/latch.hpp"
 
 #include <iostream>
+#include <map>
 #include <memory>
 #include <thread>
 #include <boost/filesystem.hpp>
@@ -154,6 +155,30 @@ BOOST_AUTO_TEST_CASE(Clear)
     BOOST_CHECK_THROW(c.get(KEY), CargoException);
 }
 
+BOOST_AUTO_TEST_CASE(Replace)
+{
+    c.set(KEY, "3");
+    c.set(KEY + ".0", "A");
+    c.set(KEY + ".1", "B");
+    c.set(KEY + ".2", "C");
+    c.set(KEY + "2", "D");
+
+    std::map<std::string, std::string> values = {
+        {KEY, "2"},
+        {KEY + ".0", "A"},
+        {KEY + ".1", "E"}
+    };
+    // Size, changed and removed value
+    BOOST_CHECK_EQUAL(c.replace(KEY, values), 3);
+    BOOST_CHECK_EQUAL(c.replace(KEY, values), 0);
+
+    BOOST_CHECK_EQUAL(c.get(KEY), "2");
+    BOOST_CHECK_EQUAL(c.get(KEY + ".0"), "A");
+    BOOST_CHECK_EQUAL(c.get(KEY + ".1"), "E");
+    BOOST_CHECK(!c.exists(KEY + ".2"));
+    BOOST_CHECK_EQUAL(c.get(KEY + "2"), "D");
+}
+
 BOOST_AUTO_TEST_CASE(Transaction)
 {
     {
@@ -31,8 +31,29 @@
 #include "logger/formatter.hpp"
 #include "logger/backend.hpp"
 #include "logger/backend-stderr.hpp"
-
+#include "logger/backend-async.hpp"
+#include "logger/backend-binary.hpp"
+#include "logger/backend-syslog.hpp"
+#ifdef HAVE_SYSTEMD
+#include "logger/backend-journal.hpp"
+#endif
+#include "logger/binary-decoder.hpp"
+#include "utils/latch.hpp"
+#include "utils/fs.hpp"
+#include "utils/scoped-dir.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <list>
 #include <stdexcept>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <syslog.h>
+#include <unistd.h>
 
 BOOST_AUTO_TEST_SUITE(LoggerSuite)
 
@@ -40,6 +61,10 @@ using namespace logger;
 
 namespace {
 
+const std::string TEST_DIR = "/tmp/ut-logger";
+const std::string LOG_PATH = TEST_DIR + "/log.txt";
+const std::string SOCKET_PATH = TEST_DIR + "/log.socket";
+
 class StubbedBackend : public LogBackend {
 public:
     StubbedBackend(std::ostringstream& s) : mLogStream(s) {}
@@ -60,6 +85,28 @@ private:
     std::ostringstream& mLogStream;
 };
 
+class BlockingBackend : public LogBackend {
+public:
+    BlockingBackend(utils::Latch& unblocked, unsigned int& count)
+        : mUnblocked(unblocked), mCount(count) {}
+
+    void log(LogLevel,
+             const std::string&,
+             const unsigned int&,
+             const std::string&,
+             const std::string&) override
+    {
+        // Keep the latch open for the next records
+        mUnblocked.wait();
+        mUnblocked.set();
+        ++mCount;
+    }
+
+private:
+    utils::Latch& mUnblocked;
+    unsigned int& mCount;
+};
+
 class TestLog {
 public:
     TestLog(LogLevel level)
@@ -83,10 +130,59 @@ public:
         }
         return false;
     }
+
+    size_t logCount(const std::string& expression) const
+    {
+        std::string s = mLogStream.str();
+        size_t count = 0;
+        for (size_t pos = s.find(expression); pos != std::string::npos; pos = s.find(expression, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
 private:
     std::ostringstream mLogStream;
 };
 
+// Stands in for the syslog or the journal socket
+class DatagramReceiver {
+public:
+    DatagramReceiver(const std::string& path)
+        : mPath(path)
+    {
+        mFD = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        BOOST_REQUIRE(mFD != -1);
+
+        struct sockaddr_un address;
+        ::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        ::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        BOOST_REQUIRE(::bind(mFD, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != -1);
+    }
+
+    ~DatagramReceiver()
+    {
+        ::close(mFD);
+        ::unlink(mPath.c_str());
+    }
+
+    // Returns the datagrams that are already waiting
+    std::vector<std::string> receive()
+    {
+        std::vector<std::string> datagrams;
+        char buffer[4096];
+        ssize_t size;
+        while ((size = ::recv(mFD, buffer, sizeof(buffer), MSG_DONTWAIT)) >= 0) {
+            datagrams.emplace_back(buffer, static_cast<size_t>(size));
+        }
+        return datagrams;
+    }
+
+private:
+    std::string mPath;
+    int mFD;
+};
+
 void exampleTestLogs(void)
 {
     LOGE("test log error " << "1");
@@ -217,5 +313,470 @@ BOOST_AUTO_TEST_CASE(LoggerScope)
     }
 }
 
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+BOOST_AUTO_TEST_CASE(LoggerScopeLogsOnlyWhenEnabled)
+{
+    int evaluated = 0;
+    auto message = [&evaluated]() -> std::string {
+        ++evaluated;
+        return "scoped";
+    };
+
+    {
+        TestLog tf(LogLevel::DEBUG);
+        {
+            LOGS("Disabled " << message());
+        }
+        BOOST_CHECK_EQUAL(evaluated, 0);
+        BOOST_CHECK(tf.logContains("scoped") == false);
+    }
+
+    {
+        TestLog tf(LogLevel::TRACE);
+        {
+            LOGS("Enabled " << message());
+        }
+        BOOST_CHECK_EQUAL(evaluated, 1);
+        BOOST_CHECK(tf.logContains("Entering: Enabled scoped") == true);
+        BOOST_CHECK(tf.logContains("Leaving:  Enabled scoped") == true);
+    }
+
+    {
+        TestLog tf(LogLevel::TRACE);
+        // LOGS is a single statement, the condition guards all of it
+        const bool isGuarded = false;
+        if (isGuarded)
+            LOGS("Guarded " << message());
+        BOOST_CHECK_EQUAL(evaluated, 1);
+        BOOST_CHECK(tf.logContains("Guarded") == false);
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(LogsEveryN)
+{
+    TestLog tf(LogLevel::WARN);
+    for (int i = 0; i < 10; ++i) {
+        LOGW_EVERY_N(3, "sampled " << i << ";");
+        LOGI_EVERY_N(3, "disabled " << i << ";");
+    }
+
+    BOOST_CHECK_EQUAL(tf.logCount("sampled"), 4u);
+    BOOST_CHECK(tf.logContains("sampled 0;"));
+    BOOST_CHECK(tf.logContains("sampled 3;"));
+    BOOST_CHECK(tf.logContains("sampled 9;"));
+    BOOST_CHECK(!tf.logContains("disabled"));
+
+    // Runtime n, 0 logs nothing
+    for (unsigned int n = 0; n < 2; ++n) {
+        LOGW_EVERY_N(n, "every " << n << ";");
+    }
+    BOOST_CHECK(!tf.logContains("every 0;"));
+    BOOST_CHECK(tf.logContains("every 1;"));
+}
+
+BOOST_AUTO_TEST_CASE(LogsRateLimit)
+{
+    const unsigned int INTERVAL_MS = 500;
+
+    TestLog tf(LogLevel::WARN);
+    auto logLimited = [](int i) {
+        LOGE_RATELIMIT(INTERVAL_MS, "limited " << i << ";");
+    };
+
+    for (int i = 0; i < 5; ++i) {
+        logLimited(i);
+    }
+    BOOST_CHECK_EQUAL(tf.logCount("limited"), 1u);
+    BOOST_CHECK(tf.logContains("limited 0;"));
+    BOOST_CHECK(!tf.logContains("Suppressed"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(INTERVAL_MS + 100));
+    logLimited(5);
+    BOOST_CHECK(tf.logContains("Suppressed 4 messages"));
+    BOOST_CHECK(tf.logContains("limited 5;"));
+}
+
+BOOST_AUTO_TEST_CASE(AsyncBackendWritesAll)
+{
+    const int THREADS = 4;
+    const int LOGS_PER_THREAD = 1000;
+
+    std::ostringstream logStream;
+    Logger::setLogLevel(LogLevel::ERROR);
+    Logger::setLogBackend(new AsyncBackend(new StubbedBackend(logStream), 64, AsyncBackend::OverflowPolicy::BLOCK));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREADS; ++i) {
+        threads.emplace_back([i] {
+            for (int j = 0; j < LOGS_PER_THREAD; ++j) {
+                LOGE("thread " << i << " log " << j);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Destroying the backend writes the rest of the records
+    Logger::setLogLevel(LogLevel::TRACE);
+    Logger::setLogBackend(new StderrBackend());
+
+    const std::string logs = logStream.str();
+    BOOST_CHECK_EQUAL(std::count(logs.begin(), logs.end(), '\n'), THREADS * LOGS_PER_THREAD);
+    for (int i = 0; i < THREADS; ++i) {
+        // Order of one thread's logs is kept
+        const std::string prefix = "thread " + std::to_string(i) + " log ";
+        size_t first = logs.find(prefix + "0\n");
+        size_t last = logs.find(prefix + std::to_string(LOGS_PER_THREAD - 1) + "\n");
+        BOOST_REQUIRE(first != std::string::npos);
+        BOOST_REQUIRE(last != std::string::npos);
+        BOOST_CHECK(first < last);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SetLogBackendWhileLogging)
+{
+    const int THREADS = 4;
+    const int LOGS_PER_THREAD = 1000;
+
+    // The serialized backends share a stream, every async backend writes its own
+    std::list<std::ostringstream> logStreams(1);
+    Logger::setLogLevel(LogLevel::ERROR);
+    Logger::setLogBackend(new StubbedBackend(logStreams.front()));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREADS; ++i) {
+        threads.emplace_back([i] {
+            for (int j = 0; j < LOGS_PER_THREAD; ++j) {
+                LOGE("thread " << i << " log " << j);
+            }
+        });
+    }
+    // Both the thread safe and the serialized backends are replaced while in use
+    for (int i = 0; i < 100; ++i) {
+        if (i % 2 == 0) {
+            logStreams.emplace_back();
+            Logger::setLogBackend(new AsyncBackend(new StubbedBackend(logStreams.back()),
+                                                   64,
+                                                   AsyncBackend::OverflowPolicy::BLOCK));
+        } else {
+            Logger::setLogBackend(new StubbedBackend(logStreams.front()));
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Logger::setLogLevel(LogLevel::TRACE);
+    Logger::setLogBackend(new StderrBackend());
+
+    std::string logs;
+    for (const auto& logStream : logStreams) {
+        logs += logStream.str();
+    }
+    BOOST_CHECK_EQUAL(std::count(logs.begin(), logs.end(), '\n'), THREADS * LOGS_PER_THREAD);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncBackendDropPolicy)
+{
+    const unsigned int CAPACITY = 8;
+    const unsigned int LOGS = 100;
+
+    utils::Latch unblocked;
+    unsigned int written = 0;
+    {
+        AsyncBackend backend(new BlockingBackend(unblocked, written), CAPACITY, AsyncBackend::OverflowPolicy::DROP);
+        for (unsigned int i = 0; i < LOGS; ++i) {
+            backend.log(LogLevel::ERROR, __FILE__, __LINE__, __func__, "message");
+        }
+
+        // The writer holds at most one record, the queue the rest
+        BOOST_CHECK_GE(backend.getDroppedCount(), LOGS - CAPACITY - 1);
+
+        unblocked.set();
+        backend.flush();
+        BOOST_CHECK_EQUAL(written + backend.getDroppedCount(), LOGS);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AsyncBackendKeepsThreadAndTime)
+{
+    struct timeval time = {0, 0};
+    {
+        LogFormatter::RecordScope scope(time, 12345);
+        BOOST_CHECK_EQUAL(LogFormatter::getCurrentThread(), 12345u);
+        BOOST_CHECK(LogFormatter::getHeader(LogLevel::ERROR, "file", 1, "func").find("/12345:") != std::string::npos);
+    }
+    BOOST_CHECK_NE(LogFormatter::getCurrentThread(), 12345u);
+}
+
+BOOST_AUTO_TEST_CASE(LogFormatterHeader)
+{
+    auto expectedHeader = [](const struct timeval& tv, const std::string& ms) {
+        struct tm tm;
+        ::localtime_r(&tv.tv_sec, &tm);
+        char time[9];
+        ::snprintf(time, sizeof(time), "%02d:%02d:%02d", tm.tm_hour, tm.tm_min, tm.tm_sec);
+        const std::string location = "file.cpp:10 func:";
+        return std::string(time) + "." + ms + " [ERROR]     1234/ 7: " +
+               location + std::string(60 - location.size(), ' ');
+    };
+
+    struct timeval tv;
+    tv.tv_sec = 1000000000;
+    tv.tv_usec = 5000;
+    {
+        LogFormatter::RecordScope scope(tv, 7, 1234);
+        BOOST_CHECK_EQUAL(LogFormatter::getHeader(LogLevel::ERROR, "file.cpp", 10, "func"),
+                          expectedHeader(tv, "005"));
+    }
+
+    // The same second, only the milliseconds change
+    tv.tv_usec = 987654;
+    {
+        LogFormatter::RecordScope scope(tv, 7, 1234);
+        BOOST_CHECK_EQUAL(LogFormatter::formatHeader(LogLevel::ERROR, "file.cpp", 10, "func"),
+                          expectedHeader(tv, "987"));
+    }
+
+    tv.tv_sec += 3661;
+    {
+        LogFormatter::RecordScope scope(tv, 7, 1234);
+        std::string buffer = "prefix ";
+        LogFormatter::appendHeader(buffer, LogLevel::ERROR, "file.cpp", 10, "func");
+        BOOST_CHECK_EQUAL(buffer, "prefix " + expectedHeader(tv, "987"));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FileBackendBuffers)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    const size_t BUFFER_SIZE = 1024;
+    const unsigned int LONG_INTERVAL = 1000 * 1000 /*ms*/;
+
+    {
+        FileBackend backend(LOG_PATH, BUFFER_SIZE, LONG_INTERVAL);
+        backend.log(LogLevel::ERROR, "file", 1, "func", "first line");
+        BOOST_CHECK(utils::readFileContent(LOG_PATH).empty());
+
+        backend.flush();
+        BOOST_CHECK(utils::readFileContent(LOG_PATH).find("first line\n") != std::string::npos);
+
+        // Filling the buffer writes it
+        const std::string message(BUFFER_SIZE, 'x');
+        backend.log(LogLevel::ERROR, "file", 2, "func", message);
+        BOOST_CHECK(utils::readFileContent(LOG_PATH).find(message) != std::string::npos);
+
+        backend.log(LogLevel::ERROR, "file", 3, "func", "last line");
+    }
+
+    // Destruction writes the rest
+    BOOST_CHECK(utils::readFileContent(LOG_PATH).find("last line\n") != std::string::npos);
+
+    // Unbuffered by default
+    FileBackend backend(LOG_PATH);
+    backend.log(LogLevel::ERROR, "file", 4, "func", "unbuffered line");
+    BOOST_CHECK(utils::readFileContent(LOG_PATH).find("unbuffered line\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(FileBackendRotates)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    const size_t MAX_FILE_SIZE = 4096;
+    const unsigned int ROTATED_FILES = 2;
+
+    {
+        // Write every line
+        FileBackend backend(LOG_PATH, 0, 0, MAX_FILE_SIZE, ROTATED_FILES);
+        for (int i = 0; i < 1000; ++i) {
+            backend.log(LogLevel::ERROR, "file", i, "func", "line " + std::to_string(i));
+        }
+    }
+
+    BOOST_CHECK(utils::exists(LOG_PATH + ".1"));
+    BOOST_CHECK(utils::exists(LOG_PATH + ".2"));
+    BOOST_CHECK(!utils::exists(LOG_PATH + ".3"));
+    BOOST_CHECK_LE(utils::readFileContent(LOG_PATH).size(), MAX_FILE_SIZE);
+    BOOST_CHECK_LE(utils::readFileContent(LOG_PATH + ".1").size(), MAX_FILE_SIZE);
+    BOOST_CHECK(utils::readFileContent(LOG_PATH).find("line 999\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(BinaryBackendDecodes)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+
+    for (int session = 0; session < 2; ++session) {
+        BinaryBackend backend(LOG_PATH);
+        for (unsigned int i = 0; i < 3; ++i) {
+            backend.log(LogLevel::WARN, "file.cpp", 10, "func", "message " + std::to_string(i));
+        }
+        backend.log(LogLevel::ERROR, "other.cpp", 20, "otherFunc", "");
+    }
+
+    std::ifstream in(LOG_PATH, std::ios::binary);
+    BinaryDecoder decoder(in);
+    BinaryDecoder::Message message;
+    for (int session = 0; session < 2; ++session) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            BOOST_REQUIRE(decoder.next(message));
+            BOOST_CHECK(message.level == LogLevel::WARN);
+            BOOST_CHECK_EQUAL(message.file, "file.cpp");
+            BOOST_CHECK_EQUAL(message.line, 10u);
+            BOOST_CHECK_EQUAL(message.func, "func");
+            BOOST_CHECK_EQUAL(message.message, "message " + std::to_string(i));
+            BOOST_CHECK_EQUAL(message.pid, ::getpid());
+            BOOST_CHECK_EQUAL(message.threadId, LogFormatter::getCurrentThread());
+        }
+
+        BOOST_REQUIRE(decoder.next(message));
+        BOOST_CHECK(message.level == LogLevel::ERROR);
+        BOOST_CHECK_EQUAL(message.file, "other.cpp");
+        BOOST_CHECK(message.message.empty());
+        BOOST_CHECK(BinaryDecoder::format(message).find("other.cpp:20 otherFunc:") != std::string::npos);
+    }
+    BOOST_CHECK(!decoder.next(message));
+}
+
+BOOST_AUTO_TEST_CASE(BinaryBackendCallSites)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    // The call sites are told apart by the addresses of the literals
+    static const char file[] = "file.cpp";
+    static const char func[] = "func";
+    {
+        BinaryBackend backend(LOG_PATH);
+        backend.logCallSite(LogLevel::WARN, file, 10, func, "first");
+        // Unbuffered by default
+        BOOST_CHECK(utils::readFileContent(LOG_PATH).find("first") != std::string::npos);
+    }
+    const size_t firstSize = utils::readFileContent(LOG_PATH).size();
+    BOOST_REQUIRE(::unlink(LOG_PATH.c_str()) == 0);
+    {
+        BinaryBackend backend(LOG_PATH);
+        backend.logCallSite(LogLevel::WARN, file, 10, func, "first");
+        backend.logCallSite(LogLevel::WARN, file, 10, func, "other");
+        backend.logCallSite(LogLevel::WARN, file, 11, func, "last");
+    }
+
+    std::ifstream in(LOG_PATH, std::ios::binary);
+    BinaryDecoder decoder(in);
+    BinaryDecoder::Message message;
+    BOOST_REQUIRE(decoder.next(message));
+    BOOST_REQUIRE(decoder.next(message));
+    BOOST_CHECK_EQUAL(message.file, "file.cpp");
+    BOOST_CHECK_EQUAL(message.line, 10u);
+    BOOST_CHECK_EQUAL(message.message, "other");
+    BOOST_REQUIRE(decoder.next(message));
+    BOOST_CHECK_EQUAL(message.line, 11u);
+    BOOST_CHECK_EQUAL(message.func, "func");
+    BOOST_CHECK(!decoder.next(message));
+
+    // The call site of the second message isn't written again
+    const size_t messageSize = 1 + 8 + 1 + 4 + 4 + 4;
+    const size_t siteSize = 1 + 4 + 4 + 2 + 8 + 2 + 4;
+    BOOST_CHECK_EQUAL(utils::readFileContent(LOG_PATH).size(),
+                      firstSize + messageSize + std::strlen("other") + siteSize + messageSize + std::strlen("last"));
+}
+
+BOOST_AUTO_TEST_CASE(BinaryBackendThroughLogger)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    Logger::setLogBackend(new BinaryBackend(LOG_PATH));
+    for (int i = 0; i < 2; ++i) {
+        LOGW("message " << i);
+    }
+    // Destroying the backend flushes it
+    Logger::setLogBackend(new StderrBackend());
+
+    std::ifstream in(LOG_PATH, std::ios::binary);
+    BinaryDecoder decoder(in);
+    BinaryDecoder::Message message;
+    for (int i = 0; i < 2; ++i) {
+        BOOST_REQUIRE(decoder.next(message));
+        BOOST_CHECK_EQUAL(message.message, "message " + std::to_string(i));
+        BOOST_CHECK(message.file.find("ut-logger.cpp") != std::string::npos);
+    }
+    BOOST_CHECK(!decoder.next(message));
+}
+
+BOOST_AUTO_TEST_CASE(BinaryDecoderTruncated)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    {
+        BinaryBackend backend(LOG_PATH);
+        backend.log(LogLevel::ERROR, "file.cpp", 1, "func", "message");
+    }
+
+    std::string content = utils::readFileContent(LOG_PATH);
+    std::istringstream in(content.substr(0, content.size() - 1));
+    BinaryDecoder decoder(in);
+    BinaryDecoder::Message message;
+    BOOST_CHECK_THROW(decoder.next(message), std::runtime_error);
+
+    std::istringstream text("Not a binary log");
+    BinaryDecoder textDecoder(text);
+    BOOST_CHECK_THROW(textDecoder.next(message), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(SyslogBackendBatches)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    DatagramReceiver receiver(SOCKET_PATH);
+    const size_t BATCH_SIZE = 3;
+
+    {
+        SyslogBackend backend(BATCH_SIZE, SOCKET_PATH);
+        backend.log(LogLevel::ERROR, "file.cpp", 1, "func", "message 0");
+        backend.log(LogLevel::ERROR, "file.cpp", 2, "func", "message 1");
+        BOOST_CHECK(receiver.receive().empty());
+
+        // Full batch is sent
+        backend.log(LogLevel::INFO, "file.cpp", 3, "func", "message 2");
+        std::vector<std::string> datagrams = receiver.receive();
+        BOOST_REQUIRE_EQUAL(datagrams.size(), BATCH_SIZE);
+        for (size_t i = 0; i < BATCH_SIZE; ++i) {
+            BOOST_CHECK(datagrams[i].find("[" + std::to_string(::getpid()) + "]: ") != std::string::npos);
+            BOOST_CHECK(datagrams[i].find("file.cpp:" + std::to_string(i + 1)) != std::string::npos);
+            const std::string message = " message " + std::to_string(i);
+            BOOST_CHECK_EQUAL(datagrams[i].substr(datagrams[i].size() - message.size()), message);
+        }
+        BOOST_CHECK_EQUAL(datagrams[0].find("<" + std::to_string(LOG_USER | LOG_ERR) + ">"), 0u);
+        BOOST_CHECK_EQUAL(datagrams[2].find("<" + std::to_string(LOG_USER | LOG_INFO) + ">"), 0u);
+
+        backend.log(LogLevel::ERROR, "file.cpp", 4, "func", "message 3");
+        backend.flush();
+        BOOST_CHECK_EQUAL(receiver.receive().size(), 1u);
+
+        backend.log(LogLevel::ERROR, "file.cpp", 5, "func", "message 4");
+    }
+
+    // Destruction sends the rest
+    BOOST_CHECK_EQUAL(receiver.receive().size(), 1u);
+}
+
+#ifdef HAVE_SYSTEMD
+BOOST_AUTO_TEST_CASE(SystemdJournalBackendBatches)
+{
+    utils::ScopedDir dirGuard(TEST_DIR);
+    DatagramReceiver receiver(SOCKET_PATH);
+
+    SystemdJournalBackend backend(2, SOCKET_PATH);
+    backend.log(LogLevel::WARN, "file.cpp", 10, "func", "message");
+    BOOST_CHECK(receiver.receive().empty());
+    backend.log(LogLevel::ERROR, "file.cpp", 11, "func", "two\nlines");
+
+    std::vector<std::string> datagrams = receiver.receive();
+    BOOST_REQUIRE_EQUAL(datagrams.size(), 2u);
+    BOOST_CHECK(datagrams[0].find("PRIORITY=" + std::to_string(LOG_WARNING) + "\n") != std::string::npos);
+    BOOST_CHECK(datagrams[0].find("CODE_FILE=file.cpp\nCODE_LINE=10\nCODE_FUNC=func\n") != std::string::npos);
+    BOOST_CHECK(datagrams[0].find("MESSAGE=message\n") != std::string::npos);
+
+    // Values with new lines are prefixed with their little endian size
+    const std::string size("\x09\0\0\0\0\0\0\0", 8);
+    BOOST_CHECK(datagrams[1].find("MESSAGE\n" + size + "two\nlines\n") != std::string::npos);
+}
+#endif // HAVE_SYSTEMD
+
 BOOST_AUTO_TEST_SUITE_END()
 
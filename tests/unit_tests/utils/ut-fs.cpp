@@ -28,11 +28,13 @@
 #include "ut.hpp"
 
 #include "utils/fs.hpp"
+#include "utils/mapped-file.hpp"
 #include "utils/exception.hpp"
 #include "utils/scoped-dir.hpp"
 
 #include <memory>
 #include <sys/mount.h>
+#include <unistd.h>
 #include <boost/filesystem.hpp>
 
 using namespace utils;
@@ -86,6 +88,48 @@ BOOST_AUTO_TEST_CASE(SaveFileContent)
     BOOST_CHECK_EQUAL(REFERENCE_FILE_CONTENT, readFileContent(FILE_PATH));
 }
 
+BOOST_AUTO_TEST_CASE(MappedFileContent)
+{
+    {
+        MappedFile file(REFERENCE_FILE_PATH);
+        BOOST_CHECK_EQUAL(REFERENCE_FILE_CONTENT, std::string(file.data(), file.size()));
+    }
+
+    BOOST_REQUIRE_NO_THROW(saveFileContent(FILE_PATH, ""));
+    {
+        MappedFile file(FILE_PATH);
+        BOOST_CHECK_EQUAL(file.size(), 0);
+        BOOST_CHECK(file.data() != nullptr);
+    }
+
+    {
+        MappedFile file("/proc/self/status");
+        BOOST_CHECK(std::string(file.data(), file.size()).find("Pid:") != std::string::npos);
+    }
+
+    BOOST_CHECK_THROW(MappedFile file(BUGGY_FILE_PATH), UtilsException);
+    BOOST_CHECK_EXCEPTION(MappedFile file(TEST_PATH),
+                          UtilsException,
+                          WhatEquals(TEST_PATH + ": read failed"));
+}
+
+BOOST_AUTO_TEST_CASE(SaveFileContentAtomicKeepsMappedFile)
+{
+    BOOST_REQUIRE_NO_THROW(saveFileContent(FILE_PATH, REFERENCE_FILE_CONTENT));
+    MappedFile file(FILE_PATH);
+    BOOST_REQUIRE_NO_THROW(saveFileContentAtomic(FILE_PATH, ""));
+    BOOST_CHECK_EQUAL(REFERENCE_FILE_CONTENT, std::string(file.data(), file.size()));
+    BOOST_CHECK_EQUAL(readFileContent(FILE_PATH), "");
+
+    // The file is saved through the symlink
+    const std::string linkPath = FILE_PATH + "Link";
+    BOOST_REQUIRE(::symlink(FILE_PATH.c_str(), linkPath.c_str()) == 0);
+    BOOST_REQUIRE_NO_THROW(saveFileContentAtomic(linkPath, REFERENCE_FILE_CONTENT));
+    BOOST_CHECK(boost::filesystem::is_symlink(linkPath));
+    BOOST_CHECK_EQUAL(readFileContent(FILE_PATH), REFERENCE_FILE_CONTENT);
+    BOOST_CHECK(::unlink(linkPath.c_str()) == 0);
+}
+
 BOOST_AUTO_TEST_CASE(RemoveFile)
 {
     BOOST_REQUIRE_NO_THROW(saveFileContent(FILE_PATH, REFERENCE_FILE_CONTENT));